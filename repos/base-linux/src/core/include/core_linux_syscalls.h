@@ -48,6 +48,14 @@ inline int lx_unlink(const char *fname)
 }
 
 
+enum { LX_MFD_CLOEXEC = 1 };
+
+inline int lx_memfd_create(char const *name, unsigned flags)
+{
+	return (int)lx_syscall(SYS_memfd_create, name, flags);
+}
+
+
 /*******************************************************
  ** Functions used by core's rom-session support code **
  *******************************************************/
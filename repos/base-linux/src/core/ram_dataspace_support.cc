@@ -30,17 +30,19 @@ using namespace Core;
 
 static int ram_ds_cnt = 0;  /* counter for creating unique dataspace IDs */
 
-bool Ram_dataspace_factory::_export_ram_ds(Dataspace_component &ds)
+
+/**
+ * Create file in the resource path as backing store of a RAM dataspace
+ *
+ * Used as fallback if the kernel does not support 'memfd_create'.
+ */
+static int create_ram_ds_file()
 {
 	Linux_dataspace::Filename const fname(resource_path(), "/ds-", ram_ds_cnt++);
 
 	/* create file using a unique file name in the resource path */
 	lx_unlink(fname.string());
 	int const fd = lx_open(fname.string(), O_CREAT|O_RDWR|O_TRUNC|LX_O_CLOEXEC, S_IRWXU);
-	lx_ftruncate(fd, ds.size());
-
-	/* remember file descriptor in dataspace component object */
-	ds.fd(fd);
 
 	/*
 	 * Wipe the file from the Linux file system. The kernel will still keep the
@@ -49,6 +51,48 @@ bool Ram_dataspace_factory::_export_ram_ds(Dataspace_component &ds)
 	 * w/o the right file descriptor won't be able to open and access the file.
 	 */
 	lx_unlink(fname.string());
+	return fd;
+}
+
+
+bool Ram_dataspace_factory::_export_ram_ds(Dataspace_component &ds)
+{
+	/*
+	 * Back the dataspace by an anonymous memory file, which never appears
+	 * in the file system and is thereby neither subject to file-system
+	 * meta-data operations nor left behind if core crashes.
+	 */
+	static bool memfd_supported = true;
+
+	enum { LX_EINVAL = 22, LX_ENOSYS = 38 };
+
+	int fd = memfd_supported ? lx_memfd_create("ds", LX_MFD_CLOEXEC) : -1;
+
+	/*
+	 * Fall back to the resource path only if the kernel lacks 'memfd_create'
+	 * or the flag. Other errors such as an exhausted file-descriptor table
+	 * are transient and must not disable memfd for good.
+	 */
+	if (fd == -LX_ENOSYS || fd == -LX_EINVAL)
+		memfd_supported = false;
+
+	if (!memfd_supported)
+		fd = create_ram_ds_file();
+
+	if (fd < 0) {
+		error("unable to create backing store for RAM dataspace (", fd, ")");
+		return false;
+	}
+
+	if (lx_ftruncate(fd, ds.size()) < 0) {
+		error("unable to allocate backing store for RAM dataspace of ",
+		      Number_of_bytes(ds.size()));
+		lx_close(fd);
+		return false;
+	}
+
+	/* remember file descriptor in dataspace component object */
+	ds.fd(fd);
 	return true;
 }
 
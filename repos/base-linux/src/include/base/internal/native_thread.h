@@ -16,6 +16,7 @@
 
 #include <base/stdint.h>
 #include <base/native_capability.h>
+#include <util/reconstructible.h>
 
 #include <linux_syscalls.h>
 
@@ -57,6 +58,18 @@ struct Genode::Native_thread : Noncopyable
 
 			Lx_epoll_sd const _epoll;
 
+			/*
+			 * Events harvested by one 'epoll_wait' but not yet dispatched
+			 *
+			 * Fetching multiple events at once saves system calls if
+			 * requests for several RPC objects are pending at a time.
+			 */
+			static constexpr unsigned MAX_EVENTS = 16;
+
+			epoll_event _events[MAX_EVENTS] { };
+
+			unsigned _num_events = 0, _next_event = 0;
+
 			void _add   (Lx_sd);
 			void _remove(Lx_sd);
 
@@ -97,6 +110,84 @@ struct Genode::Native_thread : Noncopyable
 
 	} epoll { };
 
+	/**
+	 * Socket pair for receiving RPC replies, kept across RPC calls
+	 *
+	 * The socket pair is created at the first RPC call of the thread and
+	 * re-created if its descriptors got closed or re-used behind our back,
+	 * e.g., by a library that closes all file descriptors. To keep the
+	 * costs of an RPC call low, the descriptors are checked only after a
+	 * send or receive operation failed or yielded an unexpected message.
+	 * Because each
+	 * server of a former call may still hold the remote end, replies must be
+	 * validated by the caller by the means of a per-call token.
+	 */
+	class Reply_channel : Noncopyable
+	{
+		private:
+
+			Constructible<Lx_socketpair> _sockets { };
+
+			/* inodes of the sockets, used to detect re-used descriptors */
+			uint64_t _local_inode = 0, _remote_inode = 0;
+
+			uint64_t _seq = 0;
+
+			static void _close_if_unchanged(Lx_sd sd, uint64_t inode)
+			{
+				if (sd.inode() == inode)
+					lx_close(sd.value);
+			}
+
+		public:
+
+			~Reply_channel() { reset(); }
+
+			/**
+			 * Return socket pair, create it on demand
+			 */
+			Lx_socketpair const &sockets()
+			{
+				if (!_sockets.constructed()) {
+					_sockets.construct();
+					_local_inode  = _sockets->local.inode();
+					_remote_inode = _sockets->remote.inode();
+				}
+				return *_sockets;
+			}
+
+			/**
+			 * Return true if the descriptors still refer to the socket pair
+			 */
+			bool intact() const
+			{
+				return _sockets.constructed()
+				    && _sockets->local.inode()  == _local_inode
+				    && _sockets->remote.inode() == _remote_inode;
+			}
+
+			/**
+			 * Return sequence number that is unique for each call
+			 */
+			uint64_t next_seq() { return ++_seq; }
+
+			/**
+			 * Close socket pair, a new one is created on the next use
+			 *
+			 * Descriptors that got re-used for other files are left alone.
+			 */
+			void reset()
+			{
+				if (!_sockets.constructed())
+					return;
+
+				_close_if_unchanged(_sockets->local,  _local_inode);
+				_close_if_unchanged(_sockets->remote, _remote_inode);
+				_sockets.destruct();
+			}
+
+	} reply_channel { };
+
 	Native_thread() { }
 };
 
@@ -34,6 +34,11 @@ struct Genode::Rpc_destination
 	 */
 	bool foreign = true;
 
+	/*
+	 * Token of the call to answer, only used for reply capabilities
+	 */
+	uint64_t reply_token = 0;
+
 	Rpc_destination(Lx_sd socket) : socket(socket) { }
 
 	bool valid() const { return socket.valid(); }
@@ -66,6 +66,9 @@ struct Protocol_header
 	/* badge of invoked object (on call) / exception code (on reply) */
 	unsigned long protocol_word;
 
+	/* token of the call, echoed by the reply */
+	Genode::uint64_t reply_token;
+
 	Genode::size_t num_caps;
 
 	/* badges of the transferred capability arguments */
@@ -254,13 +257,15 @@ static void extract_sds_from_message(unsigned start_index,
 /**
  * Send reply to client
  */
-static inline void lx_reply(Lx_sd reply_socket, Rpc_exception_code exception_code,
+static inline void lx_reply(Rpc_destination reply_dst, Rpc_exception_code exception_code,
                             Genode::Msgbuf_base &snd_msgbuf)
 {
+	Lx_sd const reply_socket = reply_dst.socket;
 
 	Protocol_header &header = snd_msgbuf.header<Protocol_header>();
 
 	header.protocol_word = exception_code.value;
+	header.reply_token   = reply_dst.reply_token;
 
 	Message msg(header.msg_start(), sizeof(Protocol_header) + snd_msgbuf.data_size());
 
@@ -283,36 +288,97 @@ static inline void lx_reply(Lx_sd reply_socket, Rpc_exception_code exception_cod
  ** IPC client **
  ****************/
 
-Rpc_exception_code Genode::ipc_call(Native_capability dst,
-                                    Msgbuf_base &snd_msgbuf, Msgbuf_base &rcv_msgbuf,
-                                    size_t)
-{
-	if (!dst.valid()) {
-		error("attempt to call invalid capability, blocking forever");
-		sleep_forever();
-	}
+/* random bytes supplied by the kernel (AT_RANDOM), set at startup */
+extern void const *lx_at_random;
 
-	Protocol_header &snd_header = snd_msgbuf.header<Protocol_header>();
-	snd_header.protocol_word = 0;
 
-	Message snd_msg(snd_header.msg_start(),
-	                sizeof(Protocol_header) + snd_msgbuf.data_size());
+namespace {
 
-	/*
-	 * Create reply channel
+	/**
+	 * Key for generating the tokens that tie replies to RPC calls
 	 *
-	 * The reply channel will be closed when leaving the scope of 'lx_call'.
+	 * The remote end of a reply channel is handed out to the server with each
+	 * call. A server that keeps it may send forged replies to later calls of
+	 * the same thread. Each call therefore carries a token that the reply must
+	 * echo. The tokens are derived from a secret key via SipHash-2-4 so that
+	 * the tokens of former calls do not reveal those of later calls. The key
+	 * is taken from the random bytes that the Linux kernel supplies to each
+	 * process via the auxiliary vector (AT_RANDOM). The startup code
+	 * locates them on the initial stack, hybrid components obtain them via
+	 * 'getauxval'.
 	 */
-	struct Reply_channel : Lx_socketpair
+	struct Reply_token_key
 	{
-		~Reply_channel()
+		uint64_t k0 = 0, k1 = 0;
+
+		bool valid = false;
+
+		Reply_token_key()
+		{
+			if (!lx_at_random)
+				return;
+
+			char const * const random = (char const *)lx_at_random;
+
+			Genode::memcpy(&k0, random,              sizeof(k0));
+			Genode::memcpy(&k1, random + sizeof(k0), sizeof(k1));
+			valid = true;
+		}
+
+		uint64_t token(uint64_t channel_id, uint64_t seq) const
 		{
-			if (local.value  != -1) lx_close(local.value);
-			if (remote.value != -1) lx_close(remote.value);
+			auto rotl = [] (uint64_t x, unsigned b) {
+				return (x << b) | (x >> (64 - b)); };
+
+			uint64_t v0 = k0 ^ 0x736f6d6570736575ULL,
+			         v1 = k1 ^ 0x646f72616e646f6dULL,
+			         v2 = k0 ^ 0x6c7967656e657261ULL,
+			         v3 = k1 ^ 0x7465646279746573ULL;
+
+			auto rounds = [&] (unsigned n) {
+				for (unsigned i = 0; i < n; i++) {
+					v0 += v1; v1 = rotl(v1, 13); v1 ^= v0; v0 = rotl(v0, 32);
+					v2 += v3; v3 = rotl(v3, 16); v3 ^= v2;
+					v0 += v3; v3 = rotl(v3, 21); v3 ^= v0;
+					v2 += v1; v1 = rotl(v1, 17); v1 ^= v2; v2 = rotl(v2, 32);
+				}
+			};
+
+			auto compress = [&] (uint64_t m) {
+				v3 ^= m; rounds(2); v0 ^= m; };
+
+			compress(channel_id);
+			compress(seq);
+			compress(uint64_t(sizeof(channel_id) + sizeof(seq)) << 56);
+
+			v2 ^= 0xff;
+			rounds(4);
+			return v0 ^ v1 ^ v2 ^ v3;
 		}
-	} reply_channel;
+	};
+
+	Reply_token_key const &reply_token_key()
+	{
+		static Reply_token_key const key { };
+		return key;
+	}
+}
 
-	/* assemble message */
+
+/**
+ * Send request to 'dst_socket', passing the remote end of the reply channel
+ *
+ * \return  result of the 'lx_sendmsg' system call
+ */
+static int lx_request(Lx_sd dst_socket, Lx_socketpair const &reply_channel,
+                      uint64_t reply_token, Genode::Msgbuf_base &snd_msgbuf)
+{
+	Protocol_header &snd_header = snd_msgbuf.header<Protocol_header>();
+	snd_header.protocol_word = 0;
+	snd_header.reply_token   = reply_token;
+
+	Message snd_msg(snd_header.msg_start(),
+	                sizeof(Protocol_header) + snd_msgbuf.data_size());
 
 	/* marshal reply capability */
 	snd_msg.marshal_socket(reply_channel.remote);
@@ -320,43 +386,130 @@ Rpc_exception_code Genode::ipc_call(Native_capability dst,
 	/* marshal capabilities contained in 'snd_msgbuf' */
 	insert_sds_into_message(snd_msg, snd_header, snd_msgbuf);
 
+	return lx_sendmsg(dst_socket, snd_msg.msg(), 0);
+}
+
+
+static Rpc_exception_code lx_call(Native_thread::Reply_channel &reply_channel,
+                                  uint64_t const reply_token,
+                                  Native_capability dst,
+                                  Msgbuf_base &snd_msgbuf, Msgbuf_base &rcv_msgbuf)
+{
 	Lx_sd const dst_socket = Capability_space::ipc_cap_data(dst).dst.socket;
 
-	int const send_ret = lx_sendmsg(dst_socket, snd_msg.msg(), 0);
+	Lx_socketpair const *sockets_ptr = &reply_channel.sockets();
+
+	int send_ret = lx_request(dst_socket, *sockets_ptr, reply_token, snd_msgbuf);
+
+	/*
+	 * The failure may be caused by the reply channel, e.g., if one of its
+	 * descriptors got closed concurrently. Retry once with a freshly created
+	 * reply channel.
+	 */
+	if (send_ret < 0) {
+		reply_channel.reset();
+		sockets_ptr = &reply_channel.sockets();
+		send_ret    = lx_request(dst_socket, *sockets_ptr, reply_token, snd_msgbuf);
+	}
+
 	if (send_ret < 0) {
+		reply_channel.reset();
 		error(lx_getpid(), ":", lx_gettid(), " lx_sendmsg to sd ", dst_socket,
 		      " failed with ", send_ret, " in lx_call()");
 		sleep_forever();
 	}
 
+	Lx_sd const reply_socket = sockets_ptr->local;
+
 	/* receive reply */
 	Protocol_header &rcv_header = rcv_msgbuf.header<Protocol_header>();
-	rcv_header.protocol_word = 0;
 
-	Message rcv_msg(rcv_header.msg_start(),
-	                sizeof(Protocol_header) + rcv_msgbuf.capacity());
-	rcv_msg.accept_sockets(Message::MAX_SDS_PER_MSG);
+	for (;;) {
 
-	rcv_msgbuf.reset();
+		rcv_header.protocol_word = 0;
+		rcv_header.reply_token   = ~reply_token;
 
-	for (;;) {
-		int const recv_ret = lx_recvmsg(reply_channel.local, rcv_msg.msg(), 0);
+		Message rcv_msg(rcv_header.msg_start(),
+		                sizeof(Protocol_header) + rcv_msgbuf.capacity());
+		rcv_msg.accept_sockets(Message::MAX_SDS_PER_MSG);
+
+		rcv_msgbuf.reset();
+
+		int const recv_ret = lx_recvmsg(reply_socket, rcv_msg.msg(), 0);
 
 		/* system call got interrupted by a signal */
 		if (recv_ret == -LX_EINTR)
 			continue;
 
-		if (recv_ret >= 0)
-			break;
+		if (recv_ret < 0) {
+			reply_channel.reset();
+			error(lx_getpid(), ":", lx_gettid(),
+			      " ipc_call failed to receive result (", recv_ret, ")");
+			sleep_forever();
+		}
+
+		/* size of the message up to and including the token */
+		size_t const min_size = (addr_t)&rcv_header.reply_token
+		                      - (addr_t)rcv_header.msg_start()
+		                      + sizeof(rcv_header.reply_token);
+
+		if ((size_t)recv_ret >= min_size && rcv_header.reply_token == reply_token) {
+			extract_sds_from_message(0, rcv_msg, rcv_header, rcv_msgbuf);
+			return Rpc_exception_code((int)rcv_header.protocol_word);
+		}
+
+		/* drop reply that does not belong to this call */
+		for (unsigned i = 0; i < rcv_msg.num_sockets(); i++)
+			lx_close(rcv_msg.socket_at_index(i).value);
+
+		/* the reply socket may have been re-used for another file */
+		if (!reply_channel.intact()) {
+			reply_channel.reset();
+			error(lx_getpid(), ":", lx_gettid(),
+			      " ipc_call lost its reply channel");
+			sleep_forever();
+		}
 
-		error(lx_getpid(), ":", lx_gettid(),
-		      " ipc_call failed to receive result (", recv_ret, ")");
+		warning(lx_getpid(), ":", lx_gettid(), " dropped unexpected RPC reply");
+	}
+}
+
+
+Rpc_exception_code Genode::ipc_call(Native_capability dst,
+                                    Msgbuf_base &snd_msgbuf, Msgbuf_base &rcv_msgbuf,
+                                    size_t)
+{
+	if (!dst.valid()) {
+		error("attempt to call invalid capability, blocking forever");
 		sleep_forever();
 	}
 
-	extract_sds_from_message(0, rcv_msg, rcv_header, rcv_msgbuf);
+	Reply_token_key const &key = reply_token_key();
+
+	/*
+	 * Use the reply channel of the calling thread, which is kept across RPC
+	 * calls. This way, an RPC call does not need to create and close a
+	 * socket pair. The main thread has no 'Thread' object and therefore
+	 * uses a reply channel that is closed when leaving the scope of
+	 * 'ipc_call'. The same holds if no key for generating the reply tokens
+	 * is available because replies cannot be validated then.
+	 */
+	auto call_with_temporary_reply_channel = [&]
+	{
+		Native_thread::Reply_channel reply_channel { };
+		return lx_call(reply_channel, key.token(0, reply_channel.next_seq()),
+		               dst, snd_msgbuf, rcv_msgbuf);
+	};
+
+	Thread * const myself_ptr = Thread::myself();
+	if (!myself_ptr || !key.valid)
+		return call_with_temporary_reply_channel();
 
-	return Rpc_exception_code((int)rcv_header.protocol_word);
+	return myself_ptr->with_native_thread(
+		[&] (Native_thread &nt) {
+			uint64_t const token = key.token(nt.tid, nt.reply_channel.next_seq());
+			return lx_call(nt.reply_channel, token, dst, snd_msgbuf, rcv_msgbuf); },
+		[&] { return call_with_temporary_reply_channel(); });
 }
 
 
@@ -367,9 +520,7 @@ Rpc_exception_code Genode::ipc_call(Native_capability dst,
 void Genode::ipc_reply(Native_capability caller, Rpc_exception_code exc,
                        Msgbuf_base &snd_msg)
 {
-	Lx_sd const reply_socket = Capability_space::ipc_cap_data(caller).dst.socket;
-
-	lx_reply(reply_socket, exc, snd_msg);
+	lx_reply(Capability_space::ipc_cap_data(caller).dst, exc, snd_msg);
 }
 
 
@@ -380,7 +531,7 @@ Rpc_request Genode::ipc_reply_wait(Reply_capability const &last_caller,
 {
 	/* when first called, there was no request yet */
 	if (last_caller.valid() && exc.value != Rpc_exception_code::INVALID_OBJECT)
-		lx_reply(Capability_space::ipc_cap_data(last_caller).dst.socket, exc, reply_msg);
+		lx_reply(Capability_space::ipc_cap_data(last_caller).dst, exc, reply_msg);
 
 	/*
 	 * Block infinitely if called from the main thread. This may happen if the
@@ -414,13 +565,14 @@ Rpc_request Genode::ipc_reply_wait(Reply_capability const &last_caller,
 				continue;
 			}
 
-			Lx_sd const reply_socket = msg.socket_at_index(0);
+			Rpc_destination reply_dst(msg.socket_at_index(0));
+			reply_dst.reply_token = header.reply_token;
 
 			/* start at offset 1 to skip the reply channel */
 			extract_sds_from_message(1, msg, header, request_msg);
 
-			return Rpc_request(Capability_space::import(Rpc_destination(reply_socket),
-			                                            Rpc_obj_key()), selected_sd.value);
+			return Rpc_request(Capability_space::import(reply_dst, Rpc_obj_key()),
+			                   selected_sd.value);
 		}
 
 	}, [&] () -> Rpc_request { sleep_forever(); });
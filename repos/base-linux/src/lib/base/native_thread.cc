@@ -56,6 +56,12 @@ void Native_thread::Epoll::_remove(Lx_sd sd)
 	event.events = EPOLLIN;
 	event.data.fd = sd.value;
 	int ret = lx_epoll_ctl(_epoll, EPOLL_CTL_DEL, sd, &event);
+
+	/* drop pending events of the socket, its number may get reused */
+	for (unsigned i = _next_event; i < _num_events; i++)
+		if (_events[i].data.fd == sd.value)
+			_events[i].data.fd = -1;
+
 	if (ret == -2) {
 		/* ignore file already closed */
 	} else if (ret == -9) {
@@ -68,13 +74,22 @@ void Native_thread::Epoll::_remove(Lx_sd sd)
 Lx_sd Native_thread::Epoll::poll()
 {
 	for (;;) {
-		epoll_event events[1] { };
 
-		int const event_count = lx_epoll_wait(_epoll, events, 1, -1);
+		/* wait for new events once all harvested events are dispatched */
+		if (_next_event == _num_events) {
 
-		if ((event_count == 1) && (events[0].events == POLLIN)) {
+			int const event_count = lx_epoll_wait(_epoll, _events, MAX_EVENTS, -1);
+
+			_next_event = 0;
+			_num_events = (event_count > 0) ? (unsigned)event_count : 0;
+			continue;
+		}
 
-			Lx_sd const sd { events[0].data.fd };
+		epoll_event const &event = _events[_next_event++];
+
+		if (event.events == POLLIN) {
+
+			Lx_sd const sd { event.data.fd };
 
 			if (!sd.valid())
 				continue;
@@ -107,9 +122,6 @@ Lx_sd Native_thread::Epoll::poll()
 
 			return sd;
 		}
-
-		if (event_count > 1)
-			warning(lx_getpid(), ":", lx_gettid(), " too many events on epoll_wait");
 	}
 }
 
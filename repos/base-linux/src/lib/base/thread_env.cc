@@ -31,6 +31,11 @@ extern addr_t * __initial_sp;
  */
 char **lx_environ;
 
+/*
+ * Pointer to the random bytes supplied by the kernel (AT_RANDOM)
+ */
+void const *lx_at_random;
+
 /**
  * Natively aligned memory location used in the lock implementation
  */
@@ -90,5 +95,19 @@ void Genode::prepare_init_main_thread()
 	 */
 	lx_environ = (char**)&__initial_sp[3];
 
+	/*
+	 * The auxiliary vector follows the environment on the initial stack,
+	 * which stays unmodified in contrast to a libc's 'environ'
+	 */
+	enum { AT_NULL = 0, AT_RANDOM = 25 };
+
+	char **env_end = lx_environ;
+	while (*env_end)
+		env_end++;
+
+	for (addr_t const *aux = (addr_t const *)(env_end + 1); aux[0] != AT_NULL; aux += 2)
+		if (aux[0] == AT_RANDOM)
+			lx_at_random = (void const *)aux[1];
+
 	lx_exception_signal_handlers();
 }
@@ -177,11 +177,26 @@ int main()
 #pragma GCC diagnostic pop
 #include <stdio.h>
 #include <errno.h>
+#include <sys/auxv.h>
 #undef size_t
 
 using namespace Genode;
 
 
+/*
+ * Initialize the pointer to the random bytes supplied by the kernel
+ *
+ * In contrast to non-hybrid programs, the auxiliary vector cannot be located
+ * behind the environment because the libc may have reallocated 'environ'.
+ */
+extern void const *lx_at_random;
+
+__attribute__((constructor(101))) static void lx_hybrid_init_at_random()
+{
+	lx_at_random = (void const *)getauxval(AT_RANDOM);
+}
+
+
 /**
  * Return TLS key used to storing the thread meta data
  */
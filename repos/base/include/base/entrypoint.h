@@ -47,8 +47,26 @@ class Genode::Entrypoint : Noncopyable
 			virtual void handle_io_progress() = 0;
 		};
 
+		/**
+		 * Counters of the signal handling of the entrypoint
+		 */
+		struct Signal_statistics
+		{
+			uint64_t signals;  /* number of dispatched signals */
+			uint64_t wakeups;  /* number of activations by the signal proxy */
+		};
+
 	private:
 
+		/*
+		 * Maximum number of pending signals dispatched per activation by
+		 * the signal proxy. Dispatching several signals at once amortizes
+		 * the costs of the proxy round trip and of the I/O-progress
+		 * handling. The bound retains the fairness between RPCs and
+		 * signals.
+		 */
+		enum { MAX_SIGNALS_PER_WAKEUP = 16 };
+
 		struct Signal_proxy : Interface
 		{
 			GENODE_RPC(Rpc_signal, void, signal);
@@ -101,6 +119,8 @@ class Genode::Entrypoint : Noncopyable
 
 		Io_progress_handler *_io_progress_handler { nullptr };
 
+		Signal_statistics _signal_statistics { 0, 0 };
+
 		void _handle_io_progress()
 		{
 			if (_io_progress_handler != nullptr)
@@ -202,6 +222,14 @@ class Genode::Entrypoint : Noncopyable
 		 */
 		Rpc_entrypoint &rpc_ep() { return *_rpc_ep; }
 
+		/**
+		 * Return signal-handling statistics
+		 *
+		 * The counters are updated by the entrypoint thread only. Hence,
+		 * the values are consistent when called from the entrypoint.
+		 */
+		Signal_statistics signal_statistics() const { return _signal_statistics; }
+
 		/**
 		 * Register hook functor to be called after I/O signals are dispatched
 		 */
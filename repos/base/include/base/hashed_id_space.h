@@ -0,0 +1,266 @@
+/*
+ * \brief  ID name space with hash-indexed lookup
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__BASE__HASHED_ID_SPACE_H_
+#define _INCLUDE__BASE__HASHED_ID_SPACE_H_
+
+#include <util/noncopyable.h>
+#include <util/meta.h>
+#include <base/mutex.h>
+#include <base/log.h>
+#include <base/exception.h>
+#include <util/avl_tree.h>
+
+namespace Genode { template <typename T, unsigned> class Hashed_id_space; }
+
+
+/**
+ * ID name space for large populations of elements
+ *
+ * \param T        type of the objects managed by the ID space
+ * \param BUCKETS  number of hash buckets
+ *
+ * The interface corresponds to the one of 'Id_space'. The elements are
+ * distributed over 'BUCKETS' AVL trees indexed by the ID. Since IDs are
+ * mostly allocated sequentially, the elements spread evenly over the
+ * buckets, which shortens the search paths by the binary logarithm of
+ * 'BUCKETS'. The buckets are part of the ID space object. Hence, neither
+ * insertion nor lookup needs an allocator.
+ *
+ * In contrast to 'Id_space', 'for_each' does not visit the elements in the
+ * order of their IDs.
+ */
+template <typename T, unsigned BUCKETS = 64>
+class Genode::Hashed_id_space : public Noncopyable
+{
+	public:
+
+		struct Id
+		{
+			unsigned long value;
+
+			bool operator == (Id const &other) const { return value == other.value; }
+
+			void print(Output &out) const { Genode::print(out, value); }
+		};
+
+		class Element : public Avl_node<Element>
+		{
+			private:
+
+				T               &_obj;
+				Hashed_id_space &_id_space;
+				Id               _id { 0 };
+
+				friend class Hashed_id_space;
+
+				/**
+				 * Search the tree for the element with the given ID
+				 */
+				Element *_lookup(Id id)
+				{
+					if (id.value == _id.value) return this;
+
+					Element *e = Avl_node<Element>::child(id.value > _id.value);
+
+					return e ? e->_lookup(id) : 0;
+				}
+
+			public:
+
+				/**
+				 * Constructor
+				 */
+				Element(T &obj, Hashed_id_space &id_space)
+				:
+					_obj(obj), _id_space(id_space)
+				{
+					Mutex::Guard guard(_id_space._mutex);
+					_id = id_space._unused_id();
+					_id_space._bucket(_id).insert(this);
+				}
+
+				/**
+				 * Constructor
+				 */
+				Element(T &obj, Hashed_id_space &id_space, Hashed_id_space::Id id)
+				:
+					_obj(obj), _id_space(id_space), _id(id)
+				{
+					Mutex::Guard guard(_id_space._mutex);
+					_id_space._check_conflict(id);
+					_id_space._bucket(_id).insert(this);
+				}
+
+				~Element()
+				{
+					Mutex::Guard guard(_id_space._mutex);
+					_id_space._bucket(_id).remove(this);
+				}
+
+				/**
+				 * Avl_node interface
+				 */
+				bool higher(Element *other) { return other->_id.value > _id.value; }
+
+				Id id() const { return _id; }
+
+				void print(Output &out) const { Genode::print(out, _id); }
+		};
+
+	private:
+
+		static_assert(BUCKETS > 0, "hashed ID space needs at least one bucket");
+
+		Mutex mutable     _mutex { };   /* protect '_buckets' and '_cnt' */
+		Avl_tree<Element> _buckets[BUCKETS] { };
+		unsigned long     _cnt = 0;
+
+		Avl_tree<Element> &_bucket(Id id) { return _buckets[id.value % BUCKETS]; }
+
+		Element *_lookup(Id id)
+		{
+			Element * const first = _bucket(id).first();
+			return first ? first->_lookup(id) : nullptr;
+		}
+
+		/**
+		 * Return ID that does not exist within the ID space
+		 */
+		Id _unused_id()
+		{
+			unsigned long _attempts = 0;
+			for (; _attempts < ~0UL; _attempts++, _cnt++) {
+
+				Id const id { _cnt };
+
+				/* another attempt if is already in use */
+				if (_lookup(id))
+					continue;
+
+				return id;
+			}
+			/*
+			 * The number of IDs exhausts the number of unsigned long values.
+			 * In this hypothetical case, accept ID ambiguities.
+			 */
+			return { ~0UL };
+		}
+
+		void _check_conflict(Id id)
+		{
+			if (_lookup(id))
+				error("ID space misused with ambiguous IDs");
+		}
+
+	public:
+
+		class Unknown_id : Exception { };
+
+		/**
+		 * Apply functor 'fn' to each ID present in the ID space
+		 *
+		 * \param ARG  argument type passed to 'fn', must be convertible
+		 *             from 'T' via a 'static_cast'
+		 *
+		 * This function is called with the ID space locked. Hence, it is not
+		 * possible to modify the ID space from within 'fn'.
+		 */
+		template <typename ARG>
+		void for_each(auto const &fn) const
+		{
+			Mutex::Guard guard(_mutex);
+
+			for (Avl_tree<Element> const &bucket : _buckets)
+				bucket.for_each([&] (Element const &e) {
+					fn(static_cast<ARG &>(e._obj)); });
+		}
+
+		/**
+		 * Apply functor 'fn' to object with given ID, or call 'missing_fn'
+		 *
+		 * See 'for_each' for a description of the 'ARG' argument.
+		 * If the ID is not known, 'missing_fn' is called instead of 'fn'.
+		 * Both 'fn' and 'missing_fn' must have the same return type.
+		 */
+		template <typename ARG, typename FN>
+		auto apply(Id id, FN const &fn, auto const &missing_fn)
+		-> typename Trait::Functor<decltype(&FN::operator())>::Return_type
+		{
+			T *obj_ptr = nullptr;
+			{
+				Mutex::Guard guard(_mutex);
+
+				if (Element *e = _lookup(id))
+					obj_ptr = &e->_obj;
+			}
+			if (obj_ptr)
+				return fn(static_cast<ARG &>(*obj_ptr));
+			else
+				return missing_fn();
+		}
+
+		/**
+		 * Apply functor 'fn' to object with given ID
+		 *
+		 * See 'for_each' for a description of the 'ARG' argument.
+		 *
+		 * \throw Unknown_id
+		 * \deprecated
+		 * \noapi
+		 */
+		template <typename ARG, typename FN>
+		auto apply(Id id, FN const &fn)
+		-> typename Trait::Functor<decltype(&FN::operator())>::Return_type
+		{
+			using Result = typename Trait::Functor<decltype(&FN::operator())>::Return_type;
+			return apply<ARG>(id, fn, [&] () -> Result { throw Unknown_id(); });
+		}
+
+		/**
+		 * Apply functor 'fn' to an arbitrary ID present in the ID space
+		 *
+		 * \return  true if 'fn' was applied, or
+		 *          false if the ID space is empty.
+		 */
+		template <typename ARG>
+		bool apply_any(auto const &fn)
+		{
+			T *obj = nullptr;
+			{
+				Mutex::Guard guard(_mutex);
+
+				for (Avl_tree<Element> &bucket : _buckets)
+					if (bucket.first()) {
+						obj = &bucket.first()->_obj;
+						break;
+					}
+
+				if (!obj)
+					return false;
+			}
+			fn(static_cast<ARG &>(*obj));
+			return true;
+		}
+
+		~Hashed_id_space()
+		{
+			for (Avl_tree<Element> &bucket : _buckets)
+				if (bucket.first()) {
+					error("ID space not empty at destruction time");
+					return;
+				}
+		}
+};
+
+#endif /* _INCLUDE__BASE__HASHED_ID_SPACE_H_ */
@@ -67,6 +67,7 @@ class Genode::Node : Noncopyable
 		Constructible<Hrd>         _hrd     { };
 		Constructible<Xml const &> _xml_ref { };
 		Constructible<Xml>         _xml     { };
+		Constructible<Xml::Index>  _xml_index { };
 
 		auto _with(auto const &xml_fn, auto const &hrd_fn,
 		           auto const &empty_fn) const -> decltype(empty_fn())
@@ -127,6 +128,19 @@ class Genode::Node : Noncopyable
 
 		Node(Const_byte_range_ptr const &bytes);
 
+		/**
+		 * Constructor
+		 *
+		 * \param arena  backing store for an index of the node structure
+		 *
+		 * For XML data, the node structure is indexed in one pass, which
+		 * spares the repeated scanning of the data when accessing sub nodes
+		 * and attributes. This pays off for large nodes that are inspected
+		 * many times. The arena must outlive the node. If the arena is too
+		 * small for the index, the node is parsed without index.
+		 */
+		Node(Const_byte_range_ptr const &bytes, Byte_range_ptr const &arena);
+
 		template <size_t N>
 		Node(String<N> const &s)
 		: Node(Const_byte_range_ptr(s.string(), max(s.length(), 1ul) - 1ul)) { }
@@ -95,29 +95,53 @@ class Genode::Object_pool : Interface, Noncopyable
 
 	private:
 
-		Avl_tree<Entry> _tree { };
-		Mutex           _mutex { };
+		/*
+		 * The entries are distributed over buckets indexed by the object ID,
+		 * each protected by a mutex of its own. Lookups of objects residing
+		 * in different buckets thereby do not contend for the same mutex.
+		 * Object IDs are usually allocated sequentially, which spreads the
+		 * entries evenly.
+		 */
+		static constexpr unsigned NUM_BUCKETS = 16;
+
+		struct Bucket : Noncopyable
+		{
+			Avl_tree<Entry> tree  { };
+			Mutex           mutex { };
+		};
+
+		Bucket _buckets[NUM_BUCKETS] { };
+
+		Bucket &_bucket(unsigned long obj_id) { return _buckets[obj_id % NUM_BUCKETS]; }
 
 	protected:
 
 		bool empty()
 		{
-			Mutex::Guard lock_guard(_mutex);
-			return _tree.first() == nullptr;
+			for (Bucket &bucket : _buckets) {
+				Mutex::Guard lock_guard(bucket.mutex);
+				if (bucket.tree.first())
+					return false;
+			}
+			return true;
 		}
 
 	public:
 
 		void insert(OBJ_TYPE *obj)
 		{
-			Mutex::Guard lock_guard(_mutex);
-			_tree.insert(obj);
+			Bucket &bucket = _bucket(obj->_obj_id());
+
+			Mutex::Guard lock_guard(bucket.mutex);
+			bucket.tree.insert(obj);
 		}
 
 		void remove(OBJ_TYPE *obj)
 		{
-			Mutex::Guard lock_guard(_mutex);
-			_tree.remove(obj);
+			Bucket &bucket = _bucket(obj->_obj_id());
+
+			Mutex::Guard lock_guard(bucket.mutex);
+			bucket.tree.remove(obj);
 		}
 
 		template <typename FN>
@@ -132,10 +156,12 @@ class Genode::Object_pool : Interface, Noncopyable
 			Weak_ptr ptr;
 
 			{
-				Mutex::Guard lock_guard(_mutex);
+				Bucket &bucket = _bucket(capid);
 
-				Entry * entry = _tree.first() ?
-					_tree.first()->find_by_obj_id(capid) : nullptr;
+				Mutex::Guard lock_guard(bucket.mutex);
+
+				Entry * entry = bucket.tree.first() ?
+					bucket.tree.first()->find_by_obj_id(capid) : nullptr;
 
 				if (entry) ptr = entry->_lock.weak_ptr();
 			}
@@ -160,24 +186,26 @@ class Genode::Object_pool : Interface, Noncopyable
 			using Weak_ptr   = Weak_ptr<typename Entry::Entry_lock>;
 			using Locked_ptr = Locked_ptr<typename Entry::Entry_lock>;
 
-			for (;;) {
-				OBJ_TYPE * obj;
+			for (Bucket &bucket : _buckets) {
+				for (;;) {
+					OBJ_TYPE * obj;
 
-				{
-					Mutex::Guard lock_guard(_mutex);
+					{
+						Mutex::Guard lock_guard(bucket.mutex);
 
-					if (!((obj = (OBJ_TYPE*) _tree.first()))) return;
+						if (!((obj = (OBJ_TYPE*) bucket.tree.first()))) break;
 
-					Weak_ptr ptr = obj->_lock.weak_ptr();
-					{
-						Locked_ptr lock_ptr(ptr);
-						if (!lock_ptr.valid()) return;
+						Weak_ptr ptr = obj->_lock.weak_ptr();
+						{
+							Locked_ptr lock_ptr(ptr);
+							if (!lock_ptr.valid()) return;
 
-						_tree.remove(obj);
+							bucket.tree.remove(obj);
+						}
 					}
-				}
 
-				fn(obj);
+					fn(obj);
+				}
 			}
 		}
 };
@@ -395,6 +395,23 @@ class Genode::Signal_receiver : Noncopyable
 		 */
 		Signal pending_signal();
 
+		/**
+		 * Return true if any associated context has a pending signal
+		 *
+		 * The result is a mere hint as signals may be submitted or picked
+		 * up concurrently.
+		 */
+		bool pending()
+		{
+			Mutex::Guard contexts_guard(_contexts_mutex);
+			bool result = false;
+			_contexts.for_each_locked([&] (Signal_context const &context) {
+				result = context._pending;
+				return result;
+			});
+			return result;
+		}
+
 		/**
 		 * Locally submit signal to the receiver
 		 *
@@ -0,0 +1,173 @@
+/*
+ * \brief  Utility for accessing objects by name via a hash index
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__UTIL__HASHED_DICTIONARY_H_
+#define _INCLUDE__UTIL__HASHED_DICTIONARY_H_
+
+#include <util/meta.h>
+#include <util/string.h>
+#include <util/avl_tree.h>
+#include <util/noncopyable.h>
+#include <base/log.h>
+
+namespace Genode { template <typename, typename, unsigned> class Hashed_dictionary; }
+
+
+/**
+ * Dictionary for large populations of elements
+ *
+ * \param T        element type, inherited from 'Hashed_dictionary::Element'
+ * \param NAME     type of the element names, a 'Genode::String'
+ * \param BUCKETS  number of hash buckets
+ *
+ * The interface corresponds to the one of 'Dictionary'. The elements are
+ * distributed over 'BUCKETS' AVL trees indexed by a hash of the name. The
+ * buckets are part of the dictionary object. Hence, neither insertion nor
+ * lookup needs an allocator.
+ *
+ * In contrast to 'Dictionary', 'for_each' does not visit the elements in
+ * alphabetical order.
+ */
+template <typename T, typename NAME, unsigned BUCKETS = 64>
+class Genode::Hashed_dictionary : Noncopyable
+{
+	private:
+
+		static_assert(BUCKETS > 0, "hashed dictionary needs at least one bucket");
+
+		Avl_tree<T> _buckets[BUCKETS] { };
+
+		/**
+		 * Return bucket for name, hashed via FNV-1a
+		 */
+		Avl_tree<T> &_bucket(NAME const &name)
+		{
+			uint32_t hash = 2166136261u;
+			for (char const *s = name.string(); *s; s++)
+				hash = (hash ^ uint8_t(*s))*16777619u;
+
+			return _buckets[hash % BUCKETS];
+		}
+
+	public:
+
+		class Element : private Avl_node<T>
+		{
+			public:
+
+				NAME const name;
+
+			private:
+
+				using This = Hashed_dictionary<T, NAME, BUCKETS>::Element;
+
+				Hashed_dictionary &_dictionary;
+
+				bool higher(T const *other) const { return other->This::name > name; }
+
+				friend class Avl_tree<T>;
+				friend class Avl_node<T>;
+				friend class Hashed_dictionary<T, NAME, BUCKETS>;
+
+				static T *_matching_sub_tree(T &curr, NAME const &name)
+				{
+					typename Avl_node<T>::Side side = (name > curr.This::name);
+					return curr.Avl_node<T>::child(side);
+				}
+
+			public:
+
+				Element(Hashed_dictionary &dictionary, NAME const &name)
+				:
+					name(name), _dictionary(dictionary)
+				{
+					if (_dictionary.exists(name))
+						warning("dictionary entry '", name, "' is not unique");
+
+					_dictionary._bucket(name).insert(this);
+				}
+
+				~Element()
+				{
+					_dictionary._bucket(name).remove(this);
+				}
+		};
+
+		/**
+		 * Call 'match_fn' with named mutable dictionary element
+		 *
+		 * The 'match_fn' functor is called with a non-const reference to the
+		 * matching dictionary element. If no maching element exists,
+		 * 'no_match_fn' is called without argument.
+		 */
+		template <typename FN>
+		auto with_element(NAME const &name, FN const &match_fn, auto const &no_match_fn)
+		-> typename Trait::Functor<decltype(&FN::operator())>::Return_type
+		{
+			T *curr_ptr = _bucket(name).first();
+			for (;;) {
+				if (!curr_ptr)
+					break;
+
+				if (curr_ptr->Element::name == name) {
+					return match_fn(*curr_ptr);
+				}
+
+				curr_ptr = Element::_matching_sub_tree(*curr_ptr, name);
+			}
+			return no_match_fn();
+		}
+
+		/**
+		 * Call 'match_fn' with named constant dictionary element
+		 */
+		template <typename FN>
+		auto with_element(NAME const &name, FN const &match_fn, auto const &no_match_fn) const
+		-> typename Trait::Functor<decltype(&FN::operator())>::Return_type
+		{
+			auto const_match_fn = [&] (T const &e) { return match_fn(e); };
+			auto non_const_this = const_cast<Hashed_dictionary *>(this);
+			return non_const_this->with_element(name, const_match_fn, no_match_fn);
+		}
+
+		/**
+		 * Call 'fn' with a non-const reference to any dictionary element
+		 *
+		 * \return true  if 'fn' was called, or
+		 *         false if the dictionary is empty
+		 */
+		bool with_any_element(auto const &fn)
+		{
+			for (Avl_tree<T> &bucket : _buckets)
+				if (T *curr_ptr = bucket.first()) {
+					fn(*curr_ptr);
+					return true;
+				}
+
+			return false;
+		}
+
+		void for_each(auto const &fn) const
+		{
+			for (Avl_tree<T> const &bucket : _buckets)
+				bucket.for_each(fn);
+		}
+
+		bool exists(NAME const &name) const
+		{
+			return with_element(name, [] (T const &) { return true;  },
+			                          []             { return false; });
+		}
+};
+
+#endif /* _INCLUDE__UTIL__HASHED_DICTIONARY_H_ */
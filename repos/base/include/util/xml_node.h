@@ -210,13 +210,16 @@ class Genode::Xml_node
 
 		Xml_node(Xml_node const &other)
 		:
-			_addr(other._addr), _max_len(other._max_len), _tags(other._tags)
+			_addr(other._addr), _max_len(other._max_len),
+			_index(other._index), _entry(other._entry), _tags(other._tags)
 		{ }
 
 		Xml_node &operator = (Xml_node const &other)
 		{
 			_addr    = other._addr;
 			_max_len = other._max_len;
+			_index   = other._index;
+			_entry   = other._entry;
 			_tags    = other._tags;
 			return *this;
 		}
@@ -232,6 +235,8 @@ class Genode::Xml_node
 
 	public:
 
+		class Index;
+
 		/*********************
 		 ** Exception types **
 		 *********************/
@@ -480,6 +485,9 @@ class Genode::Xml_node
 		char const * _addr;       /* first character of XML data */
 		size_t       _max_len;    /* length of XML data in characters */
 
+		Index const *_index = nullptr;  /* optional index of the document */
+		uint32_t     _entry = 0;        /* index entry of the node */
+
 		/**
 		 * Search matching end tag for given start tag and detemine number of
 		 * immediate sub nodes along the way.
@@ -579,6 +587,270 @@ class Genode::Xml_node
 			return t;
 		}
 
+	public:
+
+		/**
+		 * Index of the node structure of an XML document
+		 *
+		 * The index is built in a single pass over the document. It records
+		 * the start and end tag of each node, the links between sibling
+		 * nodes, and the location of each attribute. The tables are placed
+		 * in a caller-provided arena, which must stay unchanged as long as
+		 * the index is in use. The document must outlive the index too.
+		 *
+		 * An 'Xml_node' constructed from an index and all its sub nodes
+		 * access sub nodes and attributes via the index instead of scanning
+		 * the document each time.
+		 *
+		 * An index is invalid if the document has a syntax error or if the
+		 * arena is too small. In the worst case, each node needs
+		 * 'sizeof(Index::Entry)' bytes and each attribute needs
+		 * 'sizeof(Index::Attr)' bytes of the arena.
+		 */
+		class Index
+		{
+			public:
+
+				/*
+				 * Offsets are relative to the start of the document
+				 */
+
+				struct Entry
+				{
+					uint32_t offset;         /* start tag */
+					uint32_t lead;           /* whitespace and comments before 'offset' */
+					uint32_t end_tag;        /* relative to 'offset', 0 if empty */
+					uint32_t next;           /* next sibling, 0 if last */
+					uint32_t num_sub_nodes;  /* first sub node follows the entry */
+					uint32_t attr;           /* first attribute */
+					uint32_t num_attrs;
+				};
+
+				struct Attr
+				{
+					uint32_t offset;         /* attribute name */
+					uint32_t name_len;
+				};
+
+			private:
+
+				friend class Xml_node;
+
+				/*
+				 * Noncopyable
+				 */
+				Index(Index const &);
+				Index &operator = (Index const &);
+
+				enum : uint32_t { NONE = ~0U };
+
+				Const_byte_range_ptr const _xml;
+
+				/* entries grow upwards, attributes downwards */
+				Entry * const _entries;
+				Attr  * const _attrs_end;
+				size_t  const _capacity;
+
+				uint32_t _num_entries = 0;
+				uint32_t _num_attrs   = 0;
+
+				bool const _valid = _build();
+
+				static addr_t _aligned(addr_t addr) { return (addr + 3) & ~3UL; }
+
+				static addr_t _arena_end(Byte_range_ptr const &arena)
+				{
+					return (addr_t)arena.start + arena.num_bytes;
+				}
+
+				static size_t _arena_capacity(Byte_range_ptr const &arena)
+				{
+					addr_t const start = _aligned((addr_t)arena.start),
+					             end   = _arena_end(arena) & ~3UL;
+
+					return end > start ? end - start : 0;
+				}
+
+				bool _fits(size_t entries, size_t attrs) const
+				{
+					return entries*sizeof(Entry) + attrs*sizeof(Attr) <= _capacity;
+				}
+
+				Attr &_attr(uint32_t i) { return _attrs_end[-1 - (long)i]; }
+
+				uint32_t _offset(Token const &t) const
+				{
+					return uint32_t(t.start() - _xml.start);
+				}
+
+				/**
+				 * Return name token of the start tag of entry 'e'
+				 */
+				Token _name(Entry const &e) const
+				{
+					return Token(_xml.start + e.offset + 1, _xml.num_bytes - e.offset - 1);
+				}
+
+				bool _end_tag_matches(Entry const &e, Tag const &end) const
+				{
+					Token const start_name = _name(e);
+
+					return start_name.len() == end.name().len()
+					    && !strcmp(start_name.start(), end.name().start(),
+					               end.name().len());
+				}
+
+				bool _add_attributes(Entry &e, Tag const &tag)
+				{
+					if (!tag.has_attribute())
+						return true;
+
+					for (Xml_attribute attr = tag.attribute(); ; ) {
+
+						if (!_fits(_num_entries, _num_attrs + 1))
+							return false;
+
+						_attr(_num_attrs++) = {
+							.offset   = _offset(attr._tokens.name),
+							.name_len = uint32_t(attr._tokens.name.len()) };
+						e.num_attrs++;
+
+						Token const next = attr._next_token();
+						if (!Xml_attribute::_valid(next))
+							return true;
+
+						attr = Xml_attribute(next);
+					}
+				}
+
+				/*
+				 * While a node is open, its 'end_tag' field holds the index
+				 * of the parent and its 'next' field holds the index of its
+				 * last sub node so far.
+				 */
+				bool _build()
+				{
+					if (_xml.num_bytes >= NONE)
+						return false;
+
+					uint32_t open = NONE;
+
+					/*
+					 * Like a non-indexed 'Xml_node', the top-level node and each
+					 * first sub node cover the characters preceding their start
+					 * tag.
+					 */
+					char const *lead_start = _xml.start;
+
+					for (Token t = skip_non_tag_characters(Token(_xml.start, _xml.num_bytes));
+					     t.type() != Token::END; ) {
+
+						Comment const comment(t);
+						if (comment.valid()) {
+							t = comment.next_token();
+							continue;
+						}
+
+						Tag const tag(t);
+						if (tag.type() == Tag::INVALID) {
+							t = t.next();
+							continue;
+						}
+
+						if (tag.type() == Tag::END) {
+							if (open == NONE || !_end_tag_matches(_entries[open], tag))
+								return false;
+
+							Entry &e = _entries[open];
+							open      = e.end_tag;
+							e.end_tag = _offset(tag.token()) - e.offset;
+							e.next    = 0;
+
+							if (open == NONE)
+								return true;
+
+							t = tag.next_token();
+							lead_start = t.start();
+							continue;
+						}
+
+						if (!_fits(_num_entries + 1, _num_attrs))
+							return false;
+
+						uint32_t const i = _num_entries++;
+
+						Entry &e = _entries[i];
+						e = { .offset = _offset(tag.token()), .lead = 0, .end_tag = 0,
+						      .next = 0, .num_sub_nodes = 0, .attr = _num_attrs,
+						      .num_attrs = 0 };
+
+						if (open == NONE || _entries[open].num_sub_nodes == 0)
+							e.lead = uint32_t(tag.token().start() - lead_start);
+
+						if (!_add_attributes(e, tag))
+							return false;
+
+						if (open != NONE) {
+							Entry &parent = _entries[open];
+							if (parent.num_sub_nodes++)
+								_entries[parent.next].next = i;
+							parent.next = i;
+						}
+
+						if (tag.type() == Tag::START) {
+							e.end_tag = open;
+							open = i;
+						} else if (open == NONE) {
+							return true; /* empty top-level node */
+						}
+
+						t = tag.next_token();
+						lead_start = t.start();
+					}
+					return false;
+				}
+
+			public:
+
+				/**
+				 * Constructor
+				 *
+				 * \param xml    XML document
+				 * \param arena  backing store for the index tables
+				 */
+				Index(Const_byte_range_ptr const &xml, Byte_range_ptr const &arena)
+				:
+					_xml(xml.start, xml.num_bytes),
+					_entries((Entry *)_aligned((addr_t)arena.start)),
+					_attrs_end((Attr *)(_arena_end(arena) & ~3UL)),
+					_capacity(_arena_capacity(arena))
+				{ }
+
+				bool valid() const { return _valid; }
+
+				/**
+				 * Return number of arena bytes occupied by the index
+				 */
+				size_t num_bytes() const
+				{
+					return _num_entries*sizeof(Entry) + _num_attrs*sizeof(Attr);
+				}
+
+				Entry const &entry(uint32_t i) const
+				{
+					static Entry const invalid { };
+					return (i < _num_entries) ? _entries[i] : invalid;
+				}
+
+				Attr const &attr(uint32_t i) const
+				{
+					static Attr const invalid { };
+					return (i < _num_attrs) ? _attrs_end[-1 - (long)i] : invalid;
+				}
+		};
+
+	private:
+
 		struct Tags
 		{
 			int num_sub_nodes = 0;
@@ -590,8 +862,85 @@ class Genode::Xml_node
 				start(skip_non_tag_characters(Token(addr, max_len))),
 				end(_search_end_tag(start, num_sub_nodes))
 			{ }
+
+			/**
+			 * Constructor used for indexed nodes, which omits the search
+			 * for the end tag
+			 */
+			Tags(char const *addr, size_t max_len, Index::Entry const &e)
+			:
+				num_sub_nodes(int(e.num_sub_nodes)),
+				start(Token(addr + e.lead, max_len - e.lead)),
+				end(e.end_tag ? Tag(Token(addr + e.lead + e.end_tag,
+				                          max_len - e.lead - e.end_tag))
+				              : start)
+			{ }
 		} _tags { _addr, _max_len };
 
+		/**
+		 * Constructor used for indexed nodes
+		 */
+		Xml_node(Index const &index, uint32_t entry)
+		:
+			_addr(index._xml.start + index.entry(entry).offset - index.entry(entry).lead),
+			_max_len(index._xml.num_bytes - index.entry(entry).offset + index.entry(entry).lead),
+			_index(&index), _entry(entry),
+			_tags(_addr, _max_len, index.entry(entry))
+		{ }
+
+		/**
+		 * Call 'fn' with the entry of each sub node of an indexed node
+		 * until 'fn' returns true
+		 *
+		 * \return  true if 'fn' returned true
+		 */
+		bool _any_indexed_sub_node(auto const &fn) const
+		{
+			Index::Entry const &e = _index->entry(_entry);
+
+			uint32_t i = _entry + 1;
+			for (uint32_t n = 0; n < e.num_sub_nodes; n++, i = _index->entry(i).next)
+				if (fn(i))
+					return true;
+
+			return false;
+		}
+
+		/**
+		 * Return true if indexed node 'i' matches 'type', nullptr matches any
+		 */
+		bool _indexed_node_has_type(uint32_t i, char const *type) const
+		{
+			if (!type)
+				return true;
+
+			Token const name = _index->_name(_index->entry(i));
+
+			return strlen(type) == name.len()
+			    && !strcmp(type, name.start(), name.len());
+		}
+
+		/**
+		 * Call 'fn' for each attribute of an indexed node until 'fn' returns true
+		 */
+		void _any_indexed_attribute(auto const &fn) const
+		{
+			Index::Entry const &e = _index->entry(_entry);
+
+			for (uint32_t i = e.attr; i < e.attr + e.num_attrs; i++) {
+				Index::Attr const &a = _index->attr(i);
+				if (fn(a, Xml_attribute(Token(_index->_xml.start + a.offset,
+				                              _index->_xml.num_bytes - a.offset))))
+					return;
+			}
+		}
+
+		bool _indexed_attribute_has_type(Index::Attr const &a, char const *type) const
+		{
+			return strlen(type) == a.name_len
+			    && !strcmp(type, _index->_xml.start + a.offset, a.name_len);
+		}
+
 		/**
 		 * Return true if specified buffer contains a valid XML node
 		 */
@@ -641,7 +990,18 @@ class Genode::Xml_node
 				~Guard() { if (!ok) raise(Unexpected_error::NONEXISTENT_SUB_NODE); }
 			} guard { };
 
-			if (_tags.num_sub_nodes > 0) {
+			if (_index) {
+				uint32_t match = 0;
+				if (_any_indexed_sub_node([&] (uint32_t i) {
+					match = i;
+					return _indexed_node_has_type(i, type); }))
+				{
+					guard.ok = true;
+					return Xml_node(*_index, match);
+				}
+			}
+
+			else if (_tags.num_sub_nodes > 0) {
 
 				/* search for sub node of specified type */
 				Xml_node curr_node = _node_at(_content_base());
@@ -678,6 +1038,17 @@ class Genode::Xml_node
 			Xml_node(Const_byte_range_ptr { addr, max_len })
 		{ }
 
+		/**
+		 * Constructor for the top-level node of an indexed document
+		 *
+		 * \throw Invalid_syntax  index is invalid
+		 */
+		Xml_node(Index const &index) : Xml_node(index, 0)
+		{
+			if (!index.valid())
+				Xml_attribute::_raise_invalid_syntax();
+		}
+
 		/**
 		 * Return size of node including start and end tags in bytes
 		 */
@@ -880,6 +1251,13 @@ class Genode::Xml_node
 		 */
 		bool last(char const *type = nullptr) const
 		{
+			if (_index) {
+				for (uint32_t i = _index->entry(_entry).next; i; i = _index->entry(i).next)
+					if (_indexed_node_has_type(i, type))
+						return false;
+				return true;
+			}
+
 			Token after = _tags.end.next_token();
 			after = skip_non_tag_characters(after);
 
@@ -966,6 +1344,14 @@ class Genode::Xml_node
 		 */
 		void for_each_sub_node(char const *type, auto const &fn) const
 		{
+			if (_index) {
+				_any_indexed_sub_node([&] (uint32_t i) {
+					if (_indexed_node_has_type(i, type))
+						fn(Xml_node(*_index, i));
+					return false; });
+				return;
+			}
+
 			if (!has_sub_node(type))
 				return;
 
@@ -1011,6 +1397,14 @@ class Genode::Xml_node
 			if (type == nullptr)
 				return true;
 
+			if (_index) {
+				bool result = false;
+				_any_indexed_attribute([&] (Index::Attr const &a, Xml_attribute const &) {
+					result = _indexed_attribute_has_type(a, type);
+					return result; });
+				return result;
+			}
+
 			for (Xml_attribute attr = _tags.start.attribute(); ; ) {
 				if (attr.has_type(type))
 					return true;
@@ -1050,6 +1444,10 @@ class Genode::Xml_node
 			if (_tags.num_sub_nodes == 0)
 				return false;
 
+			if (_index)
+				return _any_indexed_sub_node([&] (uint32_t i) {
+					return _indexed_node_has_type(i, type); });
+
 			if (!_valid_node_at(_content_base()))
 				return false;
 
@@ -1093,6 +1491,15 @@ T Genode::Xml_node::attribute_value(char const *type, T const default_value) con
 	if (!_tags.start.has_attribute())
 		return result;
 
+	if (_index) {
+		_any_indexed_attribute([&] (Index::Attr const &a, Xml_attribute const &attr) {
+			if (!_indexed_attribute_has_type(a, type))
+				return false;
+			attr.value(result);
+			return true; });
+		return result;
+	}
+
 	for (Xml_attribute attr = _tags.start.attribute(); ; ) {
 
 		/* match */
@@ -1124,6 +1531,14 @@ void Genode::Xml_attribute::_raise_invalid_syntax() { throw Invalid_syntax(); }
 
 Genode::Xml_node Genode::Xml_node::next() const
 {
+	if (_index) {
+		uint32_t const next = _index->entry(_entry).next;
+		if (!next)
+			raise(Unexpected_error::NONEXISTENT_SUB_NODE);
+
+		return Xml_node(*_index, next);
+	}
+
 	Token after_node = _tags.end.next_token();
 	after_node = skip_non_tag_characters(after_node);
 	try {
@@ -1135,7 +1550,15 @@ Genode::Xml_node Genode::Xml_node::next() const
 
 Genode::Xml_node Genode::Xml_node::_sub_node(unsigned idx) const
 {
-	if (_tags.num_sub_nodes > 0) {
+	if (_index) {
+		uint32_t match = 0;
+		if (_any_indexed_sub_node([&] (uint32_t i) {
+			match = i;
+			return idx-- == 0; }))
+			return Xml_node(*_index, match);
+	}
+
+	else if (_tags.num_sub_nodes > 0) {
 		try {
 			Xml_node curr_node = _node_at(_content_base());
 			for (; idx > 0; idx--)
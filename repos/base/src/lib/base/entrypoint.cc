@@ -49,15 +49,21 @@ void Entrypoint::Signal_proxy_component::signal()
 
 	bool io_progress = false;
 
+	ep._signal_statistics.wakeups++;
+
 	/*
-	 * Try to dispatch one pending signal picked-up by the signal-proxy thread.
-	 * Note, we handle only one signal here to ensure fairness between RPCs and
-	 * signals.
+	 * Dispatch the pending signals picked-up by the signal-proxy thread.
+	 * Note, we handle only a bounded number of signals here to ensure
+	 * fairness between RPCs and signals. Repeated submissions to the same
+	 * context are already coalesced by the signal receiver.
 	 */
+	for (unsigned i = 0; i < MAX_SIGNALS_PER_WAKEUP; i++) {
+
+		Signal sig = ep._sig_rec->pending_signal();
 
-	Signal sig = ep._sig_rec->pending_signal();
+		if (!sig.valid())
+			break;
 
-	if (sig.valid()) {
 		ep._dispatch_signal(sig);
 
 		if (sig.context()->level() == Signal_context::Level::Io) {
@@ -66,6 +72,7 @@ void Entrypoint::Signal_proxy_component::signal()
 		}
 	}
 
+	/* handle I/O progress once for the whole batch */
 	if (io_progress)
 		ep._handle_io_progress();
 }
@@ -85,6 +92,8 @@ void Entrypoint::_dispatch_signal(Signal &sig)
 	if (!dispatcher)
 		return;
 
+	_signal_statistics.signals++;
+
 	dispatcher->dispatch(sig.num());
 }
 
@@ -129,6 +138,16 @@ void Entrypoint::_process_incoming_signals()
 			_signal_proxy_delivers_signal = true;
 
 			_sig_rec->block_for_signal();
+
+			/*
+			 * The signal may have been picked up already as part of
+			 * the batch dispatched at the previous activation. Spare
+			 * the entrypoint the needless activation in this case.
+			 */
+			if (!_stop_signal_proxy && !_sig_rec->pending()) {
+				_signal_proxy_delivers_signal = false;
+				continue;
+			}
 		}
 
 		/*
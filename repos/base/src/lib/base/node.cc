@@ -161,6 +161,25 @@ Node::Node(Const_byte_range_ptr const &bytes)
 }
 
 
+Node::Node(Const_byte_range_ptr const &bytes, Byte_range_ptr const &arena)
+{
+	_with_skipped_whitespace(bytes, [&] (Const_byte_range_ptr const &bytes) {
+		if (bytes.start[0] == '<') {
+			_xml_index.construct(bytes, arena);
+			try {
+				if (_xml_index->valid())
+					_xml.construct(*_xml_index);
+				else
+					_xml.construct(bytes);
+			} catch (...) { }
+		} else {
+			_hrd.construct(bytes);
+			if (!_hrd->valid()) _hrd.destruct();
+		}
+	});
+}
+
+
 Node::Node(Node const &other, Byte_range_ptr const &dst)
 {
 	other._with(
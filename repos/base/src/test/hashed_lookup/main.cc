@@ -0,0 +1,157 @@
+/*
+ * \brief  Benchmark comparing ID spaces and dictionaries with their hashed variants
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/heap.h>
+#include <base/id_space.h>
+#include <base/hashed_id_space.h>
+#include <util/dictionary.h>
+#include <util/hashed_dictionary.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Main;
+
+	struct Object { };
+
+	using Name = String<32>;
+
+	struct Named;
+	struct Hashed_named;
+}
+
+
+struct Test::Named : Dictionary<Named, Name>::Element
+{
+	Named(Dictionary<Named, Name> &dict, Name const &name)
+	: Dictionary<Named, Name>::Element(dict, name) { }
+};
+
+
+struct Test::Hashed_named : Hashed_dictionary<Hashed_named, Name>::Element
+{
+	Hashed_named(Hashed_dictionary<Hashed_named, Name> &dict, Name const &name)
+	: Hashed_dictionary<Hashed_named, Name>::Element(dict, name) { }
+};
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	unsigned const _elements = _config.node().attribute_value("elements", 10000u);
+	unsigned const _rounds   = _config.node().attribute_value("rounds",   10u);
+
+	Timer::Connection _timer { _env };
+
+	void _measure(char const *what, unsigned count, auto const &fn)
+	{
+		uint64_t const start_us = _timer.elapsed_us();
+
+		fn();
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ull);
+
+		log(what, ": ", count, " operations in ", duration_us, " us, ",
+		    (uint64_t(count)*1000*1000)/duration_us, " per second");
+	}
+
+	template <typename ID_SPACE>
+	void _measure_id_space(char const *variant)
+	{
+		using Element = typename ID_SPACE::Element;
+
+		Object   object { };
+		ID_SPACE id_space { };
+
+		size_t const array_size = sizeof(Element *)*_elements;
+		Element **elements = (Element **)_heap.alloc(array_size);
+
+		_measure(String<64>(variant, " insert").string(), _elements, [&] {
+			for (unsigned i = 0; i < _elements; i++)
+				elements[i] = new (_heap) Element(object, id_space); });
+
+		unsigned long found = 0;
+		_measure(String<64>(variant, " lookup").string(), _elements*_rounds, [&] {
+			for (unsigned r = 0; r < _rounds; r++)
+				for (unsigned i = 0; i < _elements; i++)
+					id_space.template apply<Object>(typename ID_SPACE::Id { i },
+						[&] (Object &) { found++; }, [&] { }); });
+
+		if (found != uint64_t(_elements)*_rounds)
+			error(variant, ": only ", found, " lookups succeeded");
+
+		_measure(String<64>(variant, " remove").string(), _elements, [&] {
+			for (unsigned i = 0; i < _elements; i++)
+				destroy(_heap, elements[i]); });
+
+		_heap.free(elements, array_size);
+	}
+
+	template <typename DICT, typename NAMED>
+	void _measure_dictionary(char const *variant)
+	{
+		DICT dict { };
+
+		size_t const array_size = sizeof(NAMED *)*_elements;
+		NAMED **elements = (NAMED **)_heap.alloc(array_size);
+
+		_measure(String<64>(variant, " insert").string(), _elements, [&] {
+			for (unsigned i = 0; i < _elements; i++)
+				elements[i] = new (_heap) NAMED(dict, Name("element-", i)); });
+
+		unsigned long found = 0;
+		_measure(String<64>(variant, " lookup").string(), _elements*_rounds, [&] {
+			for (unsigned r = 0; r < _rounds; r++)
+				for (unsigned i = 0; i < _elements; i++)
+					dict.with_element(elements[i]->name,
+						[&] (NAMED &) { found++; }, [&] { }); });
+
+		if (found != uint64_t(_elements)*_rounds)
+			error(variant, ": only ", found, " lookups succeeded");
+
+		_measure(String<64>(variant, " remove").string(), _elements, [&] {
+			for (unsigned i = 0; i < _elements; i++)
+				destroy(_heap, elements[i]); });
+
+		_heap.free(elements, array_size);
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- ", _elements, " elements, ", _rounds, " lookup rounds ---");
+
+		_measure_id_space<Id_space<Object>>       ("Id_space");
+		_measure_id_space<Hashed_id_space<Object>>("Hashed_id_space");
+
+		_measure_dictionary<Dictionary<Named, Name>, Named>
+			("Dictionary");
+		_measure_dictionary<Hashed_dictionary<Hashed_named, Name>, Hashed_named>
+			("Hashed_dictionary");
+
+		log("--- finished lookup benchmark ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,3 @@
+TARGET = test-hashed_lookup
+SRC_CC = main.cc
+LIBS   = base
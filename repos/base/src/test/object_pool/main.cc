@@ -0,0 +1,179 @@
+/*
+ * \brief  Benchmark for concurrent object-pool lookups
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * Multiple threads look up the RPC objects managed by an entrypoint in
+ * parallel, resembling the dispatch of RPC requests by multiple
+ * entrypoints.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/rpc_server.h>
+#include <base/blockade.h>
+#include <base/semaphore.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Interface;
+	struct Object;
+	struct Lookup_thread;
+	struct Main;
+}
+
+
+struct Test::Interface : Genode::Interface
+{
+	GENODE_RPC(Rpc_dummy, void, dummy);
+	GENODE_RPC_INTERFACE(Rpc_dummy);
+};
+
+
+struct Test::Object : Rpc_object<Test::Interface, Object>
+{
+	void dummy() { }
+};
+
+
+struct Test::Lookup_thread : Thread
+{
+	static constexpr size_t STACK_SIZE = 4*1024*sizeof(long);
+
+	Rpc_entrypoint &_ep;
+
+	Capability<Test::Interface> const * const _caps;
+
+	unsigned const _num_caps;
+	unsigned const _lookups;
+
+	Blockade   _start { };
+	Semaphore &_done;
+
+	unsigned long found = 0;
+
+	Lookup_thread(Env &env, unsigned index, Affinity::Location location,
+	              Rpc_entrypoint &ep,
+	              Capability<Test::Interface> const *caps, unsigned num_caps,
+	              unsigned lookups, Semaphore &done)
+	:
+		Thread(env, Name("lookup_", index), STACK_SIZE, location,
+		       Weight(), env.cpu()),
+		_ep(ep), _caps(caps), _num_caps(num_caps), _lookups(lookups), _done(done)
+	{ }
+
+	void entry() override
+	{
+		_start.block();
+
+		for (unsigned i = 0; i < _lookups; i++)
+			_ep.apply(_caps[i % _num_caps], [&] (Object *obj) {
+				if (obj) found++; });
+
+		_done.up();
+	}
+
+	void trigger() { _start.wakeup(); }
+
+	/*
+	 * Noncopyable
+	 */
+	Lookup_thread(Lookup_thread const &);
+	Lookup_thread &operator = (Lookup_thread const &);
+};
+
+
+struct Test::Main
+{
+	static constexpr unsigned MAX_OBJECTS = 1024;
+	static constexpr unsigned MAX_THREADS = 64;
+
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	unsigned const _num_objects =
+		min(_config.node().attribute_value("objects", 256u), MAX_OBJECTS);
+
+	unsigned const _max_threads =
+		min(_config.node().attribute_value("threads", 4u), MAX_THREADS);
+	unsigned const _lookups     = _config.node().attribute_value("lookups", 1000000u);
+
+	Timer::Connection _timer { _env };
+
+	Rpc_entrypoint _ep { &_env.pd(), Lookup_thread::STACK_SIZE,
+	                     "object_pool_ep", Affinity::Location() };
+
+	Object _objects[MAX_OBJECTS] { };
+
+	Capability<Test::Interface> _caps[MAX_OBJECTS] { };
+
+	Affinity::Space const _cpus = _env.cpu().affinity_space();
+
+	Constructible<Lookup_thread> _threads[MAX_THREADS] { };
+
+	void _measure(unsigned num_threads)
+	{
+		Semaphore done { };
+
+		for (unsigned i = 0; i < num_threads; i++) {
+			_threads[i].construct(_env, i, _cpus.location_of_index(i), _ep,
+			                      _caps, _num_objects, _lookups, done);
+			_threads[i]->start();
+		}
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < num_threads; i++)
+			_threads[i]->trigger();
+
+		for (unsigned i = 0; i < num_threads; i++)
+			done.down();
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ull);
+
+		unsigned long found = 0;
+		for (unsigned i = 0; i < num_threads; i++) {
+			found += _threads[i]->found;
+			_threads[i]->join();
+			_threads[i].destruct();
+		}
+
+		uint64_t const total = uint64_t(num_threads)*_lookups;
+
+		if (found != total)
+			error("only ", found, " of ", total, " lookups succeeded");
+
+		log(num_threads, " threads: ", total, " lookups in ", duration_us, " us, ",
+		    (total*1000*1000)/duration_us, " lookups/s");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		for (unsigned i = 0; i < _num_objects; i++)
+			_caps[i] = _ep.manage(&_objects[i]);
+
+		for (unsigned n = 1; n <= _max_threads; n++)
+			_measure(n);
+
+		for (unsigned i = 0; i < _num_objects; i++)
+			_ep.dissolve(&_objects[i]);
+
+		log("--- finished object-pool benchmark ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,86 @@
+/*
+ * \brief  Benchmark for the allocation, attachment, and release of RAM dataspaces
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/attached_dataspace.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Main;
+}
+
+
+struct Test::Main
+{
+	static constexpr unsigned MAX_DATASPACES = 256;
+
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Timer::Connection _timer { _env };
+
+	Ram_dataspace_capability _dataspaces[MAX_DATASPACES] { };
+
+	void _measure(char const *what, unsigned count, size_t size, auto const &fn)
+	{
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < count; i++)
+			fn(_dataspaces[i]);
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ull);
+
+		log(what, " ", count, " dataspaces of ", Number_of_bytes(size), ": ",
+		    duration_us, " us, ", (uint64_t(count)*1000*1000)/duration_us, " per second");
+	}
+
+	void _measure_size(unsigned count, size_t size)
+	{
+		_measure("allocate", count, size, [&] (Ram_dataspace_capability &ds) {
+			ds = _env.ram().alloc(size); });
+
+		_measure("attach, touch, and detach", count, size,
+			[&] (Ram_dataspace_capability &ds) {
+				Attached_dataspace attached { _env.rm(), ds };
+				*attached.local_addr<char volatile>() = 1; });
+
+		_measure("free", count, size, [&] (Ram_dataspace_capability &ds) {
+			_env.ram().free(ds, size);
+			ds = { }; });
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		Node const &config = _config.node();
+
+		unsigned const count =
+			min(config.attribute_value("count", 128u), MAX_DATASPACES);
+
+		config.for_each_sub_node("size", [&] (Node const &node) {
+			Number_of_bytes const size = node.attribute_value("value", Number_of_bytes(4096));
+			if (size)
+				_measure_size(count, size); });
+
+		log("--- finished RAM dataspace benchmark ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
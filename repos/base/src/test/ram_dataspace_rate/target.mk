@@ -0,0 +1,3 @@
+TARGET = test-ram_dataspace_rate
+SRC_CC = main.cc
+LIBS   = base
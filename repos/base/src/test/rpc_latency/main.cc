@@ -0,0 +1,124 @@
+/*
+ * \brief  Benchmark for measuring the RPC round-trip latency
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/rpc_server.h>
+#include <base/rpc_client.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Session;
+	struct Client;
+	struct Component;
+	struct Main;
+}
+
+
+struct Test::Session : Interface
+{
+	GENODE_RPC(Rpc_ping, unsigned, ping, unsigned);
+	GENODE_RPC(Rpc_ping_cap, Native_capability, ping_cap, Native_capability);
+	GENODE_RPC_INTERFACE(Rpc_ping, Rpc_ping_cap);
+};
+
+
+struct Test::Client : Rpc_client<Session>
+{
+	Client(Capability<Session> cap) : Rpc_client<Session>(cap) { }
+
+	unsigned ping(unsigned value) { return call<Rpc_ping>(value); }
+
+	Native_capability ping_cap(Native_capability cap) {
+		return call<Rpc_ping_cap>(cap); }
+};
+
+
+struct Test::Component : Rpc_object<Session, Component>
+{
+	unsigned ping(unsigned value) { return value + 1; }
+
+	Native_capability ping_cap(Native_capability cap) { return cap; }
+};
+
+
+struct Test::Main
+{
+	static constexpr size_t STACK_SIZE = 4*1024*sizeof(long);
+
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	unsigned const _calls  = _config.node().attribute_value("calls",  10000u);
+	unsigned const _rounds = _config.node().attribute_value("rounds", 3u);
+
+	Timer::Connection _timer { _env };
+
+	Rpc_entrypoint _rpc_ep { &_env.pd(), STACK_SIZE, "rpc_latency_ep",
+	                         Affinity::Location() };
+
+	Component _component { };
+
+	Capability<Session> _cap = _rpc_ep.manage(&_component);
+
+	Client _client { _cap };
+
+	void _measure(char const *what, auto const &call_fn)
+	{
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < _calls; i++)
+			call_fn(i);
+
+		uint64_t const duration_us = max(_timer.elapsed_us() - start_us, 1ull);
+
+		log(what, ": ", _calls, " calls in ", duration_us, " us, ",
+		    (duration_us*1000)/_calls, " ns per call, ",
+		    (uint64_t(_calls)*1000*1000)/duration_us, " calls/s");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		if (_calls == 0) {
+			error("invalid 'calls' configuration");
+			_env.parent().exit(-1);
+			return;
+		}
+
+		for (unsigned round = 0; round < _rounds; round++) {
+
+			log("round ", round + 1, " of ", _rounds);
+
+			_measure("plain RPC", [&] (unsigned i) {
+				if (_client.ping(i) != i + 1)
+					error("unexpected ping result"); });
+
+			_measure("RPC with capability", [&] (unsigned) {
+				if (!_client.ping_cap(_cap).valid())
+					error("unexpected invalid capability"); });
+		}
+
+		_rpc_ep.dissolve(&_component);
+
+		log("--- finished RPC latency benchmark ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,139 @@
+/*
+ * \brief  Benchmark for measuring the signal throughput of an entrypoint
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * A sender thread submits signals to several contexts handled by a dedicated
+ * entrypoint as fast as possible. The benchmark reports the number of
+ * dispatched signals and the number of entrypoint activations by the signal
+ * proxy per second.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/thread.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Context;
+	struct Sender;
+	struct Main;
+
+	enum { NR_OF_CONTEXTS = 8 };
+}
+
+
+struct Test::Context
+{
+	Signal_handler<Context> handler;
+
+	void _handle() { }
+
+	Context(Entrypoint &ep) : handler(ep, *this, &Context::_handle) { }
+};
+
+
+struct Test::Sender : Thread
+{
+	Context (&_contexts)[NR_OF_CONTEXTS];
+
+	bool     volatile stop       { false };
+	uint64_t          submit_cnt { 0 };
+
+	Sender(Env &env, Context (&contexts)[NR_OF_CONTEXTS])
+	:
+		Thread(env, "sender", 16*1024), _contexts(contexts)
+	{
+		start();
+	}
+
+	void entry() override
+	{
+		Signal_transmitter transmitter[NR_OF_CONTEXTS];
+		for (unsigned i = 0; i < NR_OF_CONTEXTS; i++)
+			transmitter[i] = Signal_transmitter(_contexts[i].handler);
+
+		for (unsigned i = 0; !stop; i = (i + 1) % NR_OF_CONTEXTS) {
+			transmitter[i].submit();
+			submit_cnt++;
+		}
+	}
+};
+
+
+struct Test::Main
+{
+	static constexpr size_t STACK_SIZE = 4*1024*sizeof(long);
+
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	unsigned const _duration_sec = _config.node().attribute_value("duration_sec", 3u);
+	unsigned const _rounds       = _config.node().attribute_value("rounds",       3u);
+
+	Timer::Connection _timer { _env };
+
+	Entrypoint _ep { _env, STACK_SIZE, "signal_throughput_ep", Affinity::Location() };
+
+	Context _contexts[NR_OF_CONTEXTS] { _ep, _ep, _ep, _ep, _ep, _ep, _ep, _ep };
+
+	void _measure()
+	{
+		Entrypoint::Signal_statistics const start = _ep.signal_statistics();
+
+		{
+			Sender sender { _env, _contexts };
+			_timer.msleep(_duration_sec*1000);
+			sender.stop = true;
+			sender.join();
+
+			log("sender submitted ", sender.submit_cnt / _duration_sec,
+			    " signals per second");
+		}
+
+		/* let the entrypoint drain the signals still in flight */
+		_timer.msleep(100);
+
+		Entrypoint::Signal_statistics const end = _ep.signal_statistics();
+
+		uint64_t const signals = end.signals - start.signals;
+		uint64_t const wakeups = end.wakeups - start.wakeups;
+
+		log("entrypoint dispatched ", signals / _duration_sec, " signals per second");
+		log("entrypoint was activated ", wakeups / _duration_sec, " times per second");
+		if (wakeups)
+			log("entrypoint dispatched ", signals / wakeups, " signals per activation");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		if (_duration_sec == 0) {
+			error("invalid 'duration_sec' configuration");
+			_env.parent().exit(-1);
+			return;
+		}
+
+		for (unsigned round = 0; round < _rounds; round++) {
+			log("round ", round + 1, " of ", _rounds);
+			_measure();
+		}
+
+		log("--- finished signal throughput benchmark ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
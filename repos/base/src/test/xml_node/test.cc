@@ -14,9 +14,11 @@
 
 /* Genode includes */
 #include <util/xml_node.h>
+#include <util/xml_generator.h>
 #include <base/attached_ram_dataspace.h>
 #include <base/component.h>
 #include <base/log.h>
+#include <trace/timestamp.h>
 
 using namespace Genode;
 
@@ -374,6 +376,123 @@ static void test_decoded_content(Env        &env,
 }
 
 
+/**
+ * Compare indexed node with the corresponding non-indexed node
+ */
+static bool equal(Xml_node const &plain, Xml_node const &indexed)
+{
+	using Name = String<64>;
+
+	bool result = (plain.type()          == indexed.type())
+	           && (plain.size()          == indexed.size())
+	           && (plain.content_size()  == indexed.content_size())
+	           && (plain.num_sub_nodes() == indexed.num_sub_nodes())
+	           && (plain.last()          == indexed.last())
+	           && (plain.last("program") == indexed.last("program"))
+	           && (plain.has_sub_node("program") == indexed.has_sub_node("program"));
+
+	plain.for_each_attribute([&] (Xml_attribute const &attr) {
+		Name const name = attr.name();
+		result &= indexed.has_attribute(name.string())
+		       && (plain  .attribute_value(name.string(), Name()) ==
+		           indexed.attribute_value(name.string(), Name())); });
+
+	for (unsigned i = 0; i < plain.num_sub_nodes(); i++)
+		plain.with_sub_node(i, [&] (Xml_node const &plain_sub) {
+			indexed.with_sub_node(i,
+				[&] (Xml_node const &indexed_sub) {
+					result &= equal(plain_sub, indexed_sub); },
+				[&] { result = false; }); },
+			[&] { result = false; });
+
+	return result;
+}
+
+
+static void test_indexed_node(char const *xml_string)
+{
+	static char arena[4096];
+
+	Const_byte_range_ptr const bytes(xml_string, strlen(xml_string));
+	Xml_node::Index const index(bytes, { arena, sizeof(arena) });
+
+	if (!index.valid() || !equal(Xml_node(bytes), Xml_node(index)))
+		error("indexed node differs from non-indexed node: ", Cstring(xml_string));
+}
+
+
+/**
+ * Access a large report the way a typical consumer does
+ */
+static unsigned long inspect_report(Xml_node const &report, unsigned num_entries)
+{
+	unsigned long sum = 0;
+
+	report.for_each_sub_node("entry", [&] (Xml_node const &entry) {
+		sum += entry.attribute_value("id", 0u);
+		entry.with_sub_node("state", [&] (Xml_node const &state) {
+			sum += state.attribute_value("level", 0u); }, [&] { });
+	});
+
+	/* access entries by position */
+	for (unsigned i = 0; i < num_entries; i += num_entries/8)
+		report.with_sub_node(i, [&] (Xml_node const &entry) {
+			sum += entry.attribute_value("id", 0u); }, [&] { });
+
+	return sum;
+}
+
+
+static void benchmark_indexed_node(Env &env)
+{
+	enum { NUM_ENTRIES = 24000, REPORT_SIZE = 3*1024*1024 };
+
+	Attached_ram_dataspace report_ds(env.ram(), env.rm(), REPORT_SIZE);
+	Attached_ram_dataspace arena_ds (env.ram(), env.rm(), 2*REPORT_SIZE);
+
+	Byte_range_ptr const buffer(report_ds.local_addr<char>(), REPORT_SIZE);
+
+	size_t const num_bytes = Xml_generator::generate(buffer, "report",
+		[&] (Xml_generator &xml) {
+			for (unsigned i = 0; i < NUM_ENTRIES; i++)
+				xml.node("entry", [&] {
+					xml.attribute("name",  String<16>("entry-", i));
+					xml.attribute("id",    i);
+					xml.attribute("label", "a label of moderate length");
+					xml.node("info", [&] { xml.attribute("visible", true); });
+					xml.node("state", [&] {
+						xml.attribute("level", i % 8);
+						xml.node("item"); xml.node("item");
+					});
+				});
+		}).convert<size_t>([&] (size_t n) { return n; },
+		                   [&] (Buffer_error) { return 0UL; });
+
+	Const_byte_range_ptr const bytes(buffer.start, num_bytes);
+
+	Trace::Timestamp const t0 = Trace::timestamp();
+
+	Xml_node::Index const index(bytes, { arena_ds.local_addr<char>(), 2*REPORT_SIZE });
+
+	Trace::Timestamp const t1 = Trace::timestamp();
+
+	unsigned long const indexed_sum = inspect_report(Xml_node(index), NUM_ENTRIES);
+
+	Trace::Timestamp const t2 = Trace::timestamp();
+
+	unsigned long const plain_sum = inspect_report(Xml_node(bytes), NUM_ENTRIES);
+
+	Trace::Timestamp const t3 = Trace::timestamp();
+
+	if (!index.valid() || indexed_sum != plain_sum)
+		error("indexed report inspection yields wrong result");
+
+	log("report of ", num_bytes, " bytes, index of ", index.num_bytes(), " bytes");
+	log("cycles: index build=", t1 - t0, " indexed inspection=", t2 - t1,
+	    " non-indexed inspection=", t3 - t2);
+}
+
+
 void Component::construct(Genode::Env &env)
 {
 	log("--- XML-token test ---");
@@ -452,5 +571,15 @@ void Component::construct(Genode::Env &env)
 	log("");
 
 	log("--- End of XML-parser test ---");
+
+	log("--- XML-index test ---");
+	test_indexed_node(xml_test_valid);
+	test_indexed_node(xml_test_attributes);
+	test_indexed_node(xml_test_text_between_nodes);
+	test_indexed_node(xml_test_comments);
+	test_indexed_node(xml_test_whitespace_assign);
+	benchmark_indexed_node(env);
+	log("--- End of XML-index test ---");
+
 	env.parent().exit(0);
 }
@@ -111,22 +111,41 @@ struct Gui_buffer : Genode::Noncopyable
 				fn(pixel, alpha); }); });
 	}
 
-	void reset_surface()
+	/**
+	 * Reset the part of the drawing surface covered by 'rect'
+	 */
+	void reset_surface(Rect rect)
 	{
+		rect = Rect::intersect(rect, Rect(Point(0, 0), size()));
+		if (!rect.valid())
+			return;
+
+		size_t const line_w = size().w;
+
 		with_alpha_surface([&] (Alpha_surface &alpha) {
-			Genode::memset(alpha.addr(), 0, alpha.size().count()); });
+			if (!alpha.addr())
+				return;
+
+			uint8_t *line = (uint8_t *)alpha.addr() + rect.y1()*line_w + rect.x1();
+			for (unsigned y = 0; y < rect.h(); y++, line += line_w)
+				Genode::memset(line, 0, rect.w()); });
 
 		with_pixel_surface([&] (Pixel_surface &pixel) {
 
-			Pixel_rgb888 *dst = pixel.addr();
+			Pixel_rgb888 *line = pixel.addr() + rect.y1()*line_w + rect.x1();
 			Pixel_rgb888 const color = reset_color;
 
-			for (size_t n = size().count(); n; n--)
-				*dst++ = color;
+			for (unsigned y = 0; y < rect.h(); y++, line += line_w) {
+				Pixel_rgb888 *dst = line;
+				for (unsigned n = rect.w(); n; n--)
+					*dst++ = color;
+			}
 		});
 	}
 
-	void _update_input_mask()
+	void reset_surface() { reset_surface(Rect(Point(0, 0), size())); }
+
+	void _update_input_mask(Rect const rect)
 	{
 		with_alpha_surface([&] (Alpha_surface &alpha) {
 
@@ -135,32 +154,58 @@ struct Gui_buffer : Genode::Noncopyable
 			_gui_mode.with_input_surface(_fb_ds, [&] (Input_surface &input) {
 				input.with_window(_backbuffer, [&] (Input_surface &input) {
 
-					uint8_t const * src = (uint8_t *)alpha.addr();
-					uint8_t       * dst = (uint8_t *)input.addr();
+					if (alpha.size() != input.size())
+						return;
+
+					size_t const line_w = alpha.size().w;
+					size_t const offset = rect.y1()*line_w + rect.x1();
+
+					uint8_t const * src_line = (uint8_t *)alpha.addr() + offset;
+					uint8_t       * dst_line = (uint8_t *)input.addr() + offset;
 
 					/*
 					 * Set input mask for all pixels where the alpha value is
 					 * above a given threshold. The threshold is defined such
 					 * that typical drop shadows are below the value.
 					 */
-					uint8_t const threshold  = 100;
-					size_t  const num_pixels = Genode::min(alpha.size().count(),
-					                                       input.size().count());
+					uint8_t const threshold = 100;
 
-					for (unsigned i = 0; i < num_pixels; i++)
-						*dst++ = (*src++) > threshold;
+					for (unsigned y = 0; y < rect.h(); y++) {
+
+						uint8_t const *src = src_line;
+						uint8_t       *dst = dst_line;
+
+						for (unsigned i = 0; i < rect.w(); i++)
+							*dst++ = (*src++) > threshold;
+
+						src_line += line_w;
+						dst_line += line_w;
+					}
 				});
 			});
 		});
 	}
 
-	void flush_surface()
+	/**
+	 * Make the part of the drawing surface covered by 'rect' visible
+	 *
+	 * The caller is responsible for refreshing the rectangle at the GUI
+	 * server.
+	 */
+	void flush_surface(Rect rect)
 	{
-		_update_input_mask();
+		rect = Rect::intersect(rect, Rect(Point(0, 0), size()));
+		if (!rect.valid())
+			return;
+
+		_update_input_mask(rect);
 
 		/* copy lower part of virtual framebuffer to upper part */
-		_gui.framebuffer.blit({ { 0, int(size().h) }, size() }, { 0, 0 });
+		_gui.framebuffer.blit({ rect.at + Point(0, int(size().h)), rect.area },
+		                      rect.at);
 	}
+
+	void flush_surface() { flush_surface(Rect(Point(0, 0), size())); }
 };
 
 #endif /* _INCLUDE__GEMS__GUI_BUFFER_H_ */
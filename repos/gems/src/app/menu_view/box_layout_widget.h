@@ -122,9 +122,12 @@ struct Menu_view::Box_layout_widget : Widget
 
 		/*
 		 * Apply layout to the children
+		 *
+		 * Stacking the children resets their positions, which must not
+		 * happen unless the layout is completed by a subsequent '_layout'.
 		 */
-
-		_stack_and_count_child_widgets();
+		if (_children_changed || _layout_needed)
+			_stack_and_count_child_widgets();
 	}
 
 	Area min_size() const override
@@ -123,6 +123,18 @@ struct Menu_view::Button_widget : Widget, Animator::Item
 	void draw(Surface<Pixel_rgb888> &pixel_surface,
 	          Surface<Pixel_alpha8> &alpha_surface,
 	          Point at) const override
+	{
+		/* skip blending of the textures if clipped away */
+		Rect const rect(at, _animated_geometry.area());
+		if (Rect::intersect(rect, pixel_surface.clip()).valid())
+			_draw_background(pixel_surface, alpha_surface, at);
+
+		_draw_children(pixel_surface, alpha_surface, at);
+	}
+
+	void _draw_background(Surface<Pixel_rgb888> &pixel_surface,
+	                      Surface<Pixel_alpha8> &alpha_surface,
+	                      Point at) const
 	{
 		static Scratch_surface scratch(_factory.alloc);
 
@@ -168,13 +180,15 @@ struct Menu_view::Button_widget : Widget, Animator::Item
 
 		Icon_painter::paint(alpha_surface, Rect(at, _animated_geometry.area()),
 		                    scratch.texture(), 255);
+	}
 
-		if (_selected)
-			at = at + Point(0, 1);
-
-		_draw_children(pixel_surface, alpha_surface, at);
+	Point _children_offset() const override
+	{
+		return _selected ? Point(0, 1) : Point(0, 0);
 	}
 
+	bool _animated_appearance() const override { return animated(); }
+
 	void _layout() override
 	{
 		_children.for_each([&] (Widget &child) {
@@ -109,6 +109,13 @@ class Menu_view::Cursor : List_model<Cursor>::Element
 			}
 		}
 
+		bool animated() const { return _position.animated(); }
+
+		/**
+		 * Return width of the cursor, which may exceed the glyph positions
+		 */
+		unsigned width() const { return _texture ? _texture->size().w : 1; }
+
 		bool matches(Node const &node) const
 		{
 			return _node_name(node) == _name;
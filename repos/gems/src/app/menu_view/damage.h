@@ -0,0 +1,78 @@
+/*
+ * \brief  Accumulation of areas to be redrawn
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _DAMAGE_H_
+#define _DAMAGE_H_
+
+/* local includes */
+#include <types.h>
+
+namespace Menu_view { class Damage; }
+
+
+/**
+ * Bounded set of non-overlapping rectangles
+ *
+ * Overlapping rectangles are merged into their compound. Once the maximum
+ * number of rectangles is reached, new rectangles are merged with existing
+ * ones, trading the precision of the damage for a bounded number of
+ * redraw operations.
+ */
+class Menu_view::Damage
+{
+	private:
+
+		static constexpr unsigned MAX_RECTS = 8;
+
+		Rect     _rects[MAX_RECTS] { };
+		unsigned _count = 0;
+
+	public:
+
+		void add(Rect rect)
+		{
+			if (!rect.valid())
+				return;
+
+			for (bool merged = true; merged; ) {
+
+				merged = false;
+
+				for (unsigned i = 0; i < _count && !merged; i++) {
+
+					bool const overlap = Rect::intersect(_rects[i], rect).valid();
+
+					if (!overlap && _count < MAX_RECTS)
+						continue;
+
+					rect      = Rect::compound(_rects[i], rect);
+					_rects[i] = _rects[--_count];
+					merged    = true;
+				}
+			}
+
+			_rects[_count++] = rect;
+		}
+
+		void for_each(auto const &fn) const
+		{
+			for (unsigned i = 0; i < _count; i++)
+				fn(_rects[i]);
+		}
+
+		bool empty() const { return _count == 0; }
+
+		void reset() { _count = 0; }
+};
+
+#endif /* _DAMAGE_H_ */
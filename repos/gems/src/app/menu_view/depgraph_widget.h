@@ -472,6 +472,8 @@ struct Menu_view::Depgraph_widget : Widget
 			/* create */
 			[&] (Genode::Node const &node) -> Widget &
 			{
+				_children_changed = true;
+
 				Widget &w = _factory.create(node);
 				new (alloc) Registered_node(_nodes, alloc, w, _factory.animator);
 				return w;
@@ -480,6 +482,9 @@ struct Menu_view::Depgraph_widget : Widget
 			/* destroy */
 			[&] (Widget &w)
 			{
+				_children_changed = true;
+				_vacate(w);
+
 				auto destroy_node = [&] (Registered_node &node)
 				{
 					/*
@@ -501,7 +506,8 @@ struct Menu_view::Depgraph_widget : Widget
 			},
 
 			/* update */
-			[&] (Widget &w, Genode::Node const &node) { w.update(node); }
+			[&] (Widget &w, Genode::Node const &node) {
+				_children_changed |= w.apply(node); }
 		);
 
 		/*
@@ -701,6 +707,15 @@ struct Menu_view::Depgraph_widget : Widget
 		_draw_children(pixel_surface, alpha_surface, at);
 	}
 
+	/*
+	 * The connections between the children follow the geometry animations
+	 * of the children, so the graph is redrawn as a whole while animated.
+	 */
+	bool _animated_appearance() const override
+	{
+		return _factory.animator.active();
+	}
+
 	void _layout() override
 	{
 		/*
@@ -16,6 +16,7 @@
 
 /* Genode include */
 #include <input/event.h>
+#include <trace/timestamp.h>
 
 /* gems includes */
 #include <gems/gui_buffer.h>
@@ -24,6 +25,7 @@
 #include <types.h>
 #include <widget_factory.h>
 #include <root_widget.h>
+#include <damage.h>
 
 namespace Menu_view {
 
@@ -100,6 +102,35 @@ struct Menu_view::Dialog : List_model<Dialog>::Element
 
 	bool _hovered = false;
 	bool _redraw_scheduled = false;
+	bool _redraw_all = true;
+
+	Damage _damage { };
+
+	/*
+	 * Cost of the processing of dialog updates, logged periodically if
+	 * the 'statistics' attribute of the '<dialog>' config node is set to
+	 * the number of dialog updates per log message
+	 */
+	struct Statistics
+	{
+		using Timestamp = Trace::Timestamp;
+
+		unsigned period  = 0;
+		unsigned updates = 0;
+		unsigned redraws = 0;
+
+		uint64_t update_cycles = 0, redraw_cycles = 0, redrawn_pixels = 0;
+
+		void print(Output &out) const
+		{
+			unsigned const n = max(updates, 1u);
+
+			Genode::print(out, updates, " updates, ", redraws, " redraws, "
+			              "per update: ", update_cycles/n, " layout cycles, ",
+			              redraw_cycles/n, " redraw cycles, ",
+			              redrawn_pixels/n, " pixels");
+		}
+	} _statistics { };
 
 	Area _configured_size { };
 	Area _visible_size    { };
@@ -181,23 +212,54 @@ struct Menu_view::Dialog : List_model<Dialog>::Element
 		bool const size_increased = (max_size.w > buffer_w)
 		                         || (max_size.h > buffer_h);
 
-		if (!_buffer.constructed() || size_increased)
+		if (!_buffer.constructed() || size_increased) {
 			_buffer.construct(_gui, max_size, _env.ram(), _env.rm(),
 			                  _opaque ? Gui_buffer::Alpha::OPAQUE
 			                          : Gui_buffer::Alpha::ALPHA,
 			                  _background_color);
-		else
-			_buffer->reset_surface();
+			_redraw_all = true;
+		}
 
 		_root_widget.position(Point(0, 0));
 
-		_buffer->apply_to_surface([&] (Surface<Pixel_rgb888> &pixel,
-		                               Surface<Pixel_alpha8> &alpha) {
-			_root_widget.draw(pixel, alpha, Point(0, 0));
+		Rect const buffer_rect(Point(0, 0), _buffer->size());
+
+		_root_widget.collect_damage(Point(0, 0), [&] (Rect const &rect) {
+			_damage.add(Rect::intersect(rect, buffer_rect)); });
+
+		if (_redraw_all) {
+			_damage.reset();
+			_damage.add(buffer_rect);
+			_redraw_all = false;
+		}
+
+		/*
+		 * Redraw the widget tree clipped to each damaged area and report
+		 * each area to the GUI server individually
+		 */
+		Statistics::Timestamp const start = Trace::timestamp();
+
+		_damage.for_each([&] (Rect const &rect) {
+
+			_statistics.redrawn_pixels += rect.area.count();
+
+			_buffer->reset_surface(rect);
+
+			_buffer->apply_to_surface([&] (Surface<Pixel_rgb888> &pixel,
+			                               Surface<Pixel_alpha8> &alpha) {
+				pixel.clip(rect);
+				alpha.clip(rect);
+				_root_widget.draw(pixel, alpha, Point(0, 0));
+			});
+
+			_buffer->flush_surface(rect);
+			_gui.framebuffer.refresh(rect);
 		});
+		_damage.reset();
+
+		_statistics.redraw_cycles += Trace::timestamp() - start;
+		_statistics.redraws++;
 
-		_buffer->flush_surface();
-		_gui.framebuffer.refresh({ { 0, 0 }, _buffer->size() });
 		_update_view(Rect(_position, size));
 
 		_redraw_scheduled = false;
@@ -217,6 +279,9 @@ struct Menu_view::Dialog : List_model<Dialog>::Element
 
 	void enforce_font_sytle_change()
 	{
+		_root_widget.invalidate();
+		_redraw_all = true;
+
 		_handle_dialog();
 
 		/* fast-forward geometry animation */
@@ -243,13 +308,16 @@ struct Menu_view::Dialog : List_model<Dialog>::Element
 		_configured_size  = Area ::from_node(node);
 		_opaque           = node.attribute_value("opaque", false);
 		_background_color = node.attribute_value("background", Color(127, 127, 127, 255));
+		_statistics.period = node.attribute_value("statistics", 0u);
 
 		bool const any_change = (orig_position         != _position
 		                      || orig_configured_size  != _configured_size
 		                      || orig_opaque           != _opaque
 		                      || orig_background_color != _background_color);
-		if (any_change)
+		if (any_change) {
+			_redraw_all = true;
 			_dialog_handler.local_submit();
+		}
 	}
 };
 
@@ -263,9 +331,13 @@ void Menu_view::Dialog::_handle_dialog()
 	if (dialog.has_type("empty"))
 		return;
 
-	_root_widget.update(dialog);
+	Statistics::Timestamp const start = Trace::timestamp();
+
+	_root_widget.apply(dialog);
 	_root_widget.size(_root_widget_size());
 
+	_statistics.update_cycles += Trace::timestamp() - start;
+
 	_redraw_scheduled = true;
 
 	_action.hover_changed();
@@ -277,6 +349,11 @@ void Menu_view::Dialog::_handle_dialog()
 	}
 
 	_redraw();
+
+	if (_statistics.period && ++_statistics.updates == _statistics.period) {
+		log("dialog ", _name, ": ", _statistics);
+		_statistics = { .period = _statistics.period };
+	}
 }
 
 
@@ -148,6 +148,28 @@ struct Menu_view::Label_widget : Widget, Cursor::Glyph_position
 			cursor.draw(pixel_surface, alpha_surface, at, text_size.h); });
 	}
 
+	bool _animated_appearance() const override
+	{
+		bool result = _color.animated();
+		_cursors.for_each([&] (Cursor const &cursor) {
+			result = result || cursor.animated(); });
+		return result;
+	}
+
+	Rect _drawn_area(Rect rect) const override
+	{
+		/* account for cursors that stick out at the text boundaries */
+		unsigned cursor_w = 0;
+		_cursors.for_each([&] (Cursor const &cursor) {
+			cursor_w = max(cursor_w, cursor.width()); });
+
+		if (!cursor_w)
+			return rect;
+
+		return Rect::compound(rect.p1() - Point(cursor_w, 0),
+		                      rect.p2() + Point(cursor_w, 0));
+	}
+
 	/**
 	 * Cursor::Glyph_position interface
 	 */
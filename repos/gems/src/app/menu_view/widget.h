@@ -123,34 +123,119 @@ class Menu_view::Widget : List_model<Widget>::Element
 
 		List_model<Widget> _children { };
 
+		/*
+		 * State for the incremental layout and redraw
+		 *
+		 * The checksum covers the widget's own node content, i.e., the
+		 * attributes, all sub nodes that are not widgets, and the types and
+		 * names of the child widgets. Changes of child widgets are
+		 * accounted to the children themselves.
+		 */
+		uint64_t _node_checksum    = 0;
+		bool     _changed          = true;   /* own content changed, not yet redrawn */
+		bool     _children_changed = false;  /* set during '_update_children' */
+		bool     _layout_needed    = true;   /* subtree changed since last layout */
+
+		Rect _drawn   { };  /* area covered by the most recent redraw */
+		Rect _vacated { };  /* area of destroyed child widgets */
+
+		void _vacate(Widget const &w)
+		{
+			if (!w._drawn.valid())
+				return;
+
+			_vacated = _vacated.valid() ? Rect::compound(_vacated, w._drawn)
+			                            : w._drawn;
+		}
+
 		inline void _update_children(Node const &node)
 		{
 			_children.update_from_node(node,
 
 				/* create */
 				[&] (Node const &node) -> Widget & {
+					_children_changed = true;
 					return _factory.create(node); },
 
 				/* destroy */
 				[&] (Widget &w) {
+					_children_changed = true;
+					_vacate(w);
 					_factory.destroy(&w); },
 
 				/* update */
 				[&] (Widget &w, Node const &node) {
-					w.update(node); }
+					_children_changed |= w.apply(node); }
 			);
 		}
 
+		/**
+		 * Return position of the child widgets relative to 'at'
+		 */
+		virtual Point _children_offset() const { return { }; }
+
 		void _draw_children(Surface<Pixel_rgb888> &pixel_surface,
 		                    Surface<Pixel_alpha8> &alpha_surface,
 		                    Point at) const
 		{
+			at = at + _children_offset();
+
 			_children.for_each([&] (Widget const &w) {
 				w.draw(pixel_surface, alpha_surface, at + w._animated_geometry.p1()); });
 		}
 
 		virtual void _layout() { }
 
+		/**
+		 * Return true if the widget's appearance changes on its own
+		 *
+		 * Changes of the node content and of the geometry are tracked
+		 * generically. Widgets with animations beyond the geometry
+		 * animation, e.g., color fades, override this method.
+		 */
+		virtual bool _animated_appearance() const { return false; }
+
+		/**
+		 * Return area affected by drawing the widget at 'rect'
+		 */
+		virtual Rect _drawn_area(Rect rect) const { return rect; }
+
+		static uint64_t _checksum(Node const &node)
+		{
+			struct Fnv_1a : Output
+			{
+				uint64_t value = 0xcbf29ce484222325ull;
+
+				void out_char(char c) override
+				{
+					value = (value ^ uint8_t(c))*0x100000001b3ull;
+				}
+			} checksum { };
+
+			auto out_bytes = [&] (Const_byte_range_ptr const &bytes)
+			{
+				for (size_t i = 0; i < bytes.num_bytes; i++)
+					checksum.out_char(bytes.start[i]);
+			};
+
+			Genode::print(checksum, node.type(), " ");
+
+			node.for_each_attribute([&] (Node::Attribute const &attr) {
+				Genode::print(checksum, attr.name, "=");
+				out_bytes(attr.value);
+				checksum.out_char(0);
+			});
+
+			node.for_each_sub_node([&] (Node const &sub_node) {
+				if (Widget_factory::node_type_known(sub_node))
+					Genode::print(checksum, "<", node_name(sub_node), ">");
+				else
+					Genode::print(checksum, sub_node);
+			});
+
+			return checksum.value;
+		}
+
 		Rect _inner_geometry() const
 		{
 			return Rect(Point(margin.left, margin.top),
@@ -225,6 +310,78 @@ class Menu_view::Widget : List_model<Widget>::Element
 
 		virtual void update(Node const &node) = 0;
 
+		/**
+		 * Update widget from node and track changes
+		 *
+		 * Return true if the node content of the widget or of any of its
+		 * descendants changed since the previous call.
+		 */
+		bool apply(Node const &node)
+		{
+			uint64_t const checksum = _checksum(node);
+
+			bool const own_change = (checksum != _node_checksum);
+
+			_node_checksum    = checksum;
+			_children_changed = false;
+
+			update(node);
+
+			bool const change = own_change || _children_changed;
+
+			_changed       |= own_change;
+			_layout_needed |= change;
+
+			return change;
+		}
+
+		/**
+		 * Enforce the complete relayout and redraw of the widget tree
+		 *
+		 * This is needed whenever the appearance depends on state outside
+		 * of the nodes, e.g., the styles.
+		 */
+		void invalidate()
+		{
+			_changed = _layout_needed = true;
+
+			_children.for_each([&] (Widget &w) { w.invalidate(); });
+		}
+
+		/**
+		 * Report areas that must be redrawn since the previous call
+		 *
+		 * \param at  absolute position of the widget's parent
+		 * \param fn  functor called with each affected 'Rect'
+		 *
+		 * Areas are reported for widgets that appeared, vanished, moved,
+		 * or changed their appearance. The function is expected to be called
+		 * after each layout and animation step, right before the redraw.
+		 */
+		void collect_damage(Point at, auto const &fn)
+		{
+			Point const p1   = at + _animated_geometry.p1();
+			Rect  const area = _drawn_area(Rect(p1, _animated_geometry.area()));
+
+			if (area != _drawn) {
+				fn(_drawn);
+				fn(area);
+			} else if (_changed || _animated_appearance()) {
+				fn(area);
+			}
+
+			if (_vacated.valid())
+				fn(_vacated);
+
+			_drawn   = area;
+			_vacated = Rect();
+			_changed = false;
+
+			Point const children_at = p1 + _children_offset();
+			_children.for_each([&] (Widget &w) {
+				w.collect_damage(children_at, fn); });
+		}
+
 		virtual Area min_size() const = 0;
 
 		virtual void draw(Surface<Pixel_rgb888> &pixel_surface,
@@ -236,9 +393,15 @@ class Menu_view::Widget : List_model<Widget>::Element
 		 */
 		void size(Area size)
 		{
-			_geometry = Rect(_geometry.p1(), size);
+			/* keep the layout of unchanged subtrees */
+			if (_layout_needed || size != _geometry.area) {
+
+				_geometry = Rect(_geometry.p1(), size);
 
-			_layout();
+				_layout();
+
+				_layout_needed = false;
+			}
 
 			_trigger_geometry_animation();
 		}
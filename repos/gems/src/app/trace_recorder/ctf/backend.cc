@@ -20,16 +20,20 @@ void Writer::start_iteration(Directory             &root,
                              Directory::Path const &path,
                              ::Subject_info  const &info)
 {
-	_file_path = Directory::join(path, info.thread_name());
-
-	try {
-		_dst_file.construct(root, _file_path);
-
-		/* initialise packet header */
-		_packet_buffer.init_header(info);
+	/* keep the file open across iterations to save the open/close per period */
+	if (!_dst_file.constructed()) {
+		_file_path = Directory::join(path, info.thread_name());
+
+		try {
+			_dst_file.construct(root, _file_path); }
+		catch (Append_file::Create_failed)  {
+			error("Could not create file.");
+			return;
+		}
 	}
-	catch (Append_file::Create_failed)  {
-		error("Could not create file."); }
+
+	/* initialise packet header */
+	_packet_buffer.init_header(info);
 }
 
 void Writer::process_event(Trace_recorder::Trace_event_base const &trace_event, size_t length)
@@ -52,8 +56,8 @@ void Writer::process_event(Trace_recorder::Trace_event_base const &trace_event,
 
 void Writer::end_iteration()
 {
+	if (!_dst_file.constructed()) return;
+
 	/* write buffer to file */
 	_packet_buffer.write_to_file(*_dst_file, _file_path);
-
-	_dst_file.destruct();
 }
@@ -43,7 +43,24 @@ Trace_recorder::Monitor::Config Trace_recorder::Monitor::Config::from_node(Node
 }
 
 
-void Trace_recorder::Monitor::Attached_buffer::process_events(Trace_directory &trace_directory)
+Trace_recorder::Monitor::Period Trace_recorder::Monitor::Period::from_node(Node const &config)
+{
+	unsigned const period_ms = config.attribute_value("period_ms", 0u);
+
+	unsigned const min_period_ms =
+		min(period_ms, config.attribute_value("min_period_ms", period_ms));
+
+	return {
+		.max_ms     = period_ms,
+		.min_ms     = max(min_period_ms, 1u),
+		.watermark  = min(config.attribute_value("watermark",
+		                                         (unsigned)DEFAULT_WATERMARK_PERCENT), 100u),
+		.current_ms = period_ms,
+	};
+}
+
+
+unsigned Trace_recorder::Monitor::Attached_buffer::process_events(Trace_directory &trace_directory)
 {
 	/* start iteration for every writer */
 	_writers.for_each([&] (Writer_base &writer) {
@@ -53,10 +70,13 @@ void Trace_recorder::Monitor::Attached_buffer::process_events(Trace_directory &t
 	});
 
 	/* iterate entries and pass each entry to every writer */
+	size_t consumed_bytes = 0;
 	_buffer.for_each_new_entry([&] (Trace::Buffer::Entry &entry) {
 		if (entry.length() == 0)
 			return true;
 
+		consumed_bytes += entry.length() + sizeof(size_t);
+
 		_writers.for_each([&] (Writer_base &writer) {
 			writer.process_event(entry.object<Trace_event_base>(), entry.length());
 		});
@@ -66,6 +86,11 @@ void Trace_recorder::Monitor::Attached_buffer::process_events(Trace_directory &t
 
 	/* end iteration for every writer */
 	_writers.for_each([&] (Writer_base &writer) { writer.end_iteration(); });
+
+	if (!_partition_size)
+		return 0;
+
+	return (unsigned)min(consumed_bytes*100 / _partition_size, (size_t)100);
 }
 
 
@@ -98,9 +123,20 @@ void Trace_recorder::Monitor::_with_session_policy(Trace::Subject_info const &in
 
 void Trace_recorder::Monitor::_handle_timeout()
 {
+	if (!_trace_directory.constructed())
+		return;
+
+	unsigned max_fill_percent = 0;
 	_trace_buffers.for_each([&] (Attached_buffer &buf) {
-		buf.process_events(*_trace_directory);
+		max_fill_percent = max(max_fill_percent,
+		                       buf.process_events(*_trace_directory));
 	});
+
+	if (!_period.max_ms)
+		return;
+
+	_period.adapt(max_fill_percent);
+	_timer.trigger_once(_period.current_ms * 1000ull);
 }
 
 
@@ -200,19 +236,21 @@ void Trace_recorder::Monitor::start(Node const &config)
 		warning("number of subjects equals limit, results may be truncated");
 
 	/* register timeout */
-	unsigned period_ms { 0 };
-	if (!config.has_attribute("period_ms"))
+	if (!config.has_attribute("period_ms")) {
 		error("missing node attribute 'period_ms'");
-	else
-		period_ms = config.attribute_value("period_ms", period_ms);
+		return;
+	}
 
-	_timer.trigger_periodic(period_ms * 1000);
+	_period = Period::from_node(config);
+	if (_period.current_ms)
+		_timer.trigger_once(_period.current_ms * 1000ull);
 }
 
 
 void Trace_recorder::Monitor::stop()
 {
 	_timer.trigger_periodic(0);
+	_period = { 0, 0, 0, 0 };
 
 	_trace_buffers.for_each([&] (Attached_buffer &buf) {
 
@@ -222,6 +260,10 @@ void Trace_recorder::Monitor::stop()
 		/* read remaining events from buffers */
 		buf.process_events(*_trace_directory);
 
+		if (buf.lost_entries())
+			warning(buf.info().session_label(), " -> ", buf.info().thread_name(),
+			        ": lost ", buf.lost_entries(), " entries in total");
+
 		/* destroy writers */
 		buf.writers().for_each([&] (Writer_base &writer) {
 			destroy(_alloc, &writer); });
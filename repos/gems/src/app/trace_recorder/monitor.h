@@ -43,6 +43,7 @@ class Trace_recorder::Monitor
 			DEFAULT_BUFFER_SIZE              =   64u * 1024,
 			DEFAULT_TRACE_SESSION_RAM        = 1024u * 1024,
 			DEFAULT_TRACE_SESSION_ARG_BUFFER =  128u * 1024,
+			DEFAULT_WATERMARK_PERCENT        =   50,
 		};
 
 		class Trace_directory
@@ -79,6 +80,7 @@ class Trace_recorder::Monitor
 
 				Env                               &_env;
 				Attached_dataspace                 _ds;
+				size_t                      const  _partition_size;
 				Trace_buffer                       _buffer;
 				Registry<Attached_buffer>::Element _element;
 				Subject_info                       _info;
@@ -95,18 +97,26 @@ class Trace_recorder::Monitor
 				:
 					_env(env),
 					_ds(env.rm(), ds),
+					_partition_size(_ds.size() / 2),
 					_buffer(*_ds.local_addr<Trace::Buffer>()),
 					_element(registry, *this),
 					_info(info),
 					_subject_id(id)
 				{ }
 
-				void process_events(Trace_directory &);
+				/**
+				 * Pass new events to all writers
+				 *
+				 * \return  fill level of the buffer partition that was
+				 *          consumed, in percent
+				 */
+				unsigned process_events(Trace_directory &);
 
 				Registry<Writer_base>   &writers()            { return _writers; }
 
 				Subject_info      const &info()         const { return _info;   }
 				Trace::Subject_id const  subject_id()   const { return _subject_id; }
+				unsigned long long       lost_entries() const { return _buffer.lost_entries(); }
 		};
 
 		Env                           &_env;
@@ -128,6 +138,34 @@ class Trace_recorder::Monitor
 			static Config from_node(Node const &);
 		};
 
+		/*
+		 * Adaptive polling period
+		 *
+		 * Whenever a buffer is filled above the watermark when being
+		 * processed, the period is halved (down to 'min_ms') so that the
+		 * buffers are drained before the producer wraps. The period is
+		 * doubled again (up to 'max_ms') once the load has calmed down.
+		 */
+		struct Period
+		{
+			unsigned max_ms;
+			unsigned min_ms;
+			unsigned watermark;   /* in percent of a buffer partition */
+			unsigned current_ms;
+
+			static Period from_node(Node const &);
+
+			void adapt(unsigned fill_percent)
+			{
+				if (fill_percent >= watermark)
+					current_ms = max(min_ms, current_ms / 2);
+				else if (fill_percent < watermark / 2)
+					current_ms = min(max_ms, current_ms * 2);
+			}
+		};
+
+		Period                         _period           { 0, 0, 0, 0 };
+
 		Constructible<Trace::Connection> _trace          { };
 
 		Signal_handler<Monitor>        _timeout_handler  { _env.ep(),
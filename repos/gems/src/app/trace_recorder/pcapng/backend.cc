@@ -27,23 +27,28 @@ void Writer::start_iteration(Directory             &root,
                              Directory::Path const &path,
                              ::Subject_info  const &)
 {
-	/* write to '${path}.pcapng */
-	Path<Directory::MAX_PATH_LEN> pcap_file { path };
-	pcap_file.append(".pcapng");
+	/* keep the file open across iterations to save the open/close per period */
+	if (!_dst_file.constructed()) {
 
-	_file_path = Directory::Path(pcap_file.string());
+		/* write to '${path}.pcapng */
+		Path<Directory::MAX_PATH_LEN> pcap_file { path };
+		pcap_file.append(".pcapng");
 
-	/* append to file */
-	try {
-		_dst_file.construct(root, _file_path);
+		_file_path = Directory::Path(pcap_file.string());
 
-		_interface_registry.clear();
-		_buffer.clear();
-		(void)_buffer.append<Section_header_block>(); /* header always fits in */
-		_empty_section = true;
+		/* append to file */
+		try {
+			_dst_file.construct(root, _file_path); }
+		catch (Append_file::Create_failed)  {
+			error("Could not create file.");
+			return;
+		}
 	}
-	catch (Append_file::Create_failed)  {
-		error("Could not create file."); }
+
+	_interface_registry.clear();
+	_buffer.clear();
+	(void)_buffer.append<Section_header_block>(); /* header always fits in */
+	_empty_section = true;
 }
 
 
@@ -119,11 +124,10 @@ void Writer::process_event(Trace_recorder::Trace_event_base const &trace_event,
 void Writer::end_iteration()
 {
 	/* write buffer to file */
-	if (!_empty_section)
+	if (!_empty_section && _dst_file.constructed())
 		_buffer.write_to_file(*_dst_file, _file_path);
 
 	_buffer.clear();
-	_dst_file.destruct();
 }
 
 
@@ -74,13 +74,28 @@ void Cpu_sampler::Cpu_thread_component::take_sample()
 		_parent_cpu_client->pause();
 
 		Thread_state const thread_state = _parent_cpu_client->state();
-		if (thread_state.state == Thread_state::State::VALID)
-			_sample_buf[_sample_buf_index++] = thread_state.cpu.ip;
 
 		_parent_cpu_client->resume();
 
-		if (_sample_buf_index == SAMPLE_BUF_SIZE)
+		if (thread_state.state != Thread_state::State::VALID)
+			break;
+
+		addr_t const ip = thread_state.cpu.ip;
+
+		if (_format == Output_format::RAW) {
+			_sample_buf[_sample_buf_index++] = ip;
+
+			if (_sample_buf_index == SAMPLE_BUF_SIZE)
+				flush();
+
+			break;
+		}
+
+		/* write out the aggregated samples if the histogram is crowded */
+		if (!_add_to_histogram(ip)) {
 			flush();
+			_add_to_histogram(ip);
+		}
 
 		break;
 	}
@@ -90,13 +105,42 @@ void Cpu_sampler::Cpu_thread_component::take_sample()
 }
 
 
-void Cpu_sampler::Cpu_thread_component::reset()
+bool Cpu_sampler::Cpu_thread_component::_add_to_histogram(addr_t ip)
+{
+	/* drop the alignment bits, which carry no entropy on most architectures */
+	unsigned const hash = (unsigned)((ip >> 2) ^ (ip >> 12));
+
+	for (unsigned i = 0; i < MAX_HISTOGRAM_PROBES; i++) {
+
+		Histogram_entry &entry = _histogram[(hash + i) & (HISTOGRAM_SIZE - 1)];
+
+		if (entry.count && entry.ip == ip) {
+			entry.count++;
+			return true;
+		}
+
+		if (!entry.count) {
+			entry = { .ip = ip, .count = 1 };
+			_histogram_used++;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void Cpu_sampler::Cpu_thread_component::reset(Output_format format)
 {
+	_format           = format;
 	_sample_buf_index = 0;
+	_histogram_used   = 0;
+
+	for (Histogram_entry &entry : _histogram)
+		entry = { };
 }
 
 
-void Cpu_sampler::Cpu_thread_component::flush()
+void Cpu_sampler::Cpu_thread_component::_flush_raw()
 {
 	if (_sample_buf_index == 0)
 		return;
@@ -118,6 +162,60 @@ void Cpu_sampler::Cpu_thread_component::flush()
 }
 
 
+void Cpu_sampler::Cpu_thread_component::_flush_histogram()
+{
+	if (_histogram_used == 0)
+		return;
+
+	if (!_log.constructed())
+		_log.construct(_env, _log_session_label);
+
+	/* turn the label into the stack prefix, e.g., 'init;app;ep' */
+	using Prefix = String<Session_label::capacity()>;
+
+	char prefix_buf[Prefix::capacity()] { };
+	{
+		char const *src = _label.string();
+		size_t      dst = 0;
+
+		while (*src && dst + 1 < sizeof(prefix_buf)) {
+			if (strcmp(src, " -> ", 4) == 0) {
+				prefix_buf[dst++] = ';';
+				src += 4;
+			} else {
+				prefix_buf[dst++] = *src++;
+			}
+		}
+	}
+	Cstring const prefix { prefix_buf };
+
+	using Line = String<Prefix::capacity() + 2 * sizeof(addr_t) + 16>;
+
+	for (Histogram_entry &entry : _histogram) {
+
+		if (!entry.count)
+			continue;
+
+		Line const line(prefix, ";",
+		                Hex(entry.ip, Hex::OMIT_PREFIX, Hex::PAD), " ",
+		                entry.count, "\n");
+
+		_log->write(line.string());
+
+		entry = { };
+	}
+
+	_histogram_used = 0;
+}
+
+
+void Cpu_sampler::Cpu_thread_component::flush()
+{
+	_flush_raw();
+	_flush_histogram();
+}
+
+
 Dataspace_capability
 Cpu_sampler::Cpu_thread_component::utcb()
 {
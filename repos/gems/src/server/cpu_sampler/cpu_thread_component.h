@@ -30,10 +30,30 @@ namespace Cpu_sampler {
 
 class Cpu_sampler::Cpu_thread_component : public Rpc_object<Cpu_thread>
 {
+	public:
+
+		/*
+		 * With the 'RAW' format, each sample is written as a separate line.
+		 * With the 'COLLAPSED' format, the samples are aggregated per
+		 * address and written as lines of the form
+		 * '<component>;<thread>;<address> <count>', which can be fed
+		 * directly into flame-graph tools.
+		 */
+		enum class Output_format { RAW, COLLAPSED };
+
 	private:
 
 		enum { SAMPLE_BUF_SIZE = 1024 };
 
+		/* must be a power of two */
+		enum { HISTOGRAM_SIZE = 1024, MAX_HISTOGRAM_PROBES = 16 };
+
+		struct Histogram_entry
+		{
+			addr_t   ip;
+			unsigned count;
+		};
+
 		Cpu_session_component &_cpu_session_component;
 		Env                   &_env;
 
@@ -47,9 +67,18 @@ class Cpu_sampler::Cpu_thread_component : public Rpc_object<Cpu_thread>
 		Session_label          _label;
 		Session_label          _log_session_label;
 
+		Output_format          _format = Output_format::RAW;
+
 		Genode::addr_t         _sample_buf[SAMPLE_BUF_SIZE];
 		unsigned int           _sample_buf_index = 0;
 
+		Histogram_entry        _histogram[HISTOGRAM_SIZE] { };
+		unsigned int           _histogram_used = 0;
+
+		bool _add_to_histogram(addr_t ip);
+		void _flush_raw();
+		void _flush_histogram();
+
 		Constructible<Log_connection> _log;
 
 	public:
@@ -75,7 +104,7 @@ class Cpu_sampler::Cpu_thread_component : public Rpc_object<Cpu_thread>
 		Session_label &label() { return _label; }
 
 		void take_sample();
-		void reset();
+		void reset(Output_format);
 		void flush();
 
 		/**************************
@@ -52,6 +52,11 @@ struct Cpu_sampler::Main : Thread_list_change_handler
 	unsigned int            max_sample_index;
 	Genode::uint64_t        timeout_us;
 
+	using Format_name = Genode::String<16>;
+
+	Cpu_thread_component::Output_format output_format =
+		Cpu_thread_component::Output_format::RAW;
+
 
 	void handle_timeout()
 	{
@@ -97,6 +102,11 @@ struct Cpu_sampler::Main : Thread_list_change_handler
 
 		timeout_us = sample_interval_ms * 1000;
 
+		using Output_format = Cpu_thread_component::Output_format;
+
+		output_format = (config.node().attribute_value("format", Format_name("raw")) == "collapsed")
+		              ? Output_format::COLLAPSED : Output_format::RAW;
+
 		thread_list_changed();
 
 		if (verbose_sample_duration)
@@ -139,7 +149,7 @@ struct Cpu_sampler::Main : Thread_list_change_handler
 
 			with_matching_policy(thread.label(), config.node(),
 				[&] (Node const &policy) {
-					thread.reset();
+					thread.reset(output_format);
 					selected_thread_list.insert(new (&alloc) Thread_element(&thread));
 					if (verbose)
 						Genode::log("added thread ", thread.label(), " to selection");
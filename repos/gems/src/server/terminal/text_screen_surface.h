@@ -175,6 +175,152 @@ class Terminal::Text_screen_surface
 
 		Position _pointer { -1, -1 };
 
+		struct Cell_colors { Color fg, bg; };
+
+		Cell_colors _cell_colors(Char_cell const &cell, Position pos) const
+		{
+			Color_palette::Highlighted const highlighted { cell.highlight() };
+
+			Color_palette::Index fg_idx { cell.colidx_fg() };
+			Color_palette::Index bg_idx { cell.colidx_bg() };
+
+			/* swap color index for inverse cells */
+			if (cell.inverse()) {
+				Color_palette::Index tmp { fg_idx };
+				fg_idx = bg_idx;
+				bg_idx = tmp;
+			}
+
+			if (cell.has_cursor())
+				return { .fg = Color::rgb( 63,  63,  63),
+				         .bg = Color::rgb(255, 255, 255) };
+
+			if (_pointer == pos)
+				return { .fg = Color::rgb( 50,  50,  50),
+				         .bg = Color::rgb(220, 220, 220) };
+
+			/* absent codepoints are displayed as whitespace, not selected */
+			if (_selection.selected(pos) && cell.codepoint().value)
+				return { .fg = Color::rgb( 50,  50,  50),
+				         .bg = Color::rgb(180, 180, 180) };
+
+			return { .fg = _palette.foreground(fg_idx, highlighted),
+			         .bg = _palette.background(bg_idx, highlighted) };
+		}
+
+		/**
+		 * Return horizontal pixel position of the character-grid column
+		 */
+		Fixpoint_number _column_x(unsigned column) const
+		{
+			Fixpoint_number x { (int)_geometry.start().x };
+			x.value += column*_geometry.char_width.value;
+			return x;
+		}
+
+		/**
+		 * Paint line of character cells
+		 *
+		 * The background is painted as one box per run of cells with the
+		 * same background color. Glyphs are painted for non-blank cells only.
+		 */
+		void _paint_line(Surface<PT> &surface, unsigned line, int y)
+		{
+			unsigned const num_cols = _cell_array.num_cols();
+			int      const h        = _geometry.char_height;
+
+			auto colors = [&] (unsigned column) {
+				return _cell_colors(_cell_array.get_cell(column, line),
+				                    Position(column, line)); };
+
+			unsigned run_start = 0;
+			Color    run_bg    = colors(0).bg;
+
+			for (unsigned column = 1; column <= num_cols; column++) {
+
+				bool const end_of_line = (column == num_cols);
+
+				Color const bg = end_of_line ? run_bg : colors(column).bg;
+				if (!end_of_line && bg == run_bg)
+					continue;
+
+				Box_painter::paint(surface,
+				                   Rect::compound(Point(_column_x(run_start).decimal(), y),
+				                                  Point(_column_x(column).decimal() - 1,
+				                                        y + h - 1)),
+				                   run_bg);
+				run_start = column;
+				run_bg    = bg;
+			}
+
+			int const clip_top  = 0, clip_bottom = _geometry.fb_size.h,
+			          clip_left = 0, clip_right  = _geometry.fb_size.w;
+
+			unsigned const fg_alpha = 255;
+
+			for (unsigned column = 0; column < num_cols; column++) {
+
+				Char_cell const cell = _cell_array.get_cell(column, line);
+
+				Codepoint const codepoint = cell.codepoint();
+				if (codepoint.value == 0 || codepoint.value == ' ')
+					continue;
+
+				Color const fg_color = colors(column).fg;
+				PT    const pixel(fg_color.r, fg_color.g, fg_color.b);
+
+				_font.apply_glyph(codepoint, [&] (Glyph_painter::Glyph const &glyph) {
+
+					/* horizontally align glyph within cell */
+					Fixpoint_number x = _column_x(column);
+					x.value += (_geometry.char_width.value - (int)((glyph.width - 1)<<8)) >> 1;
+
+					Glyph_painter::paint(Glyph_painter::Position(x, y),
+					                     glyph, surface.addr(), _geometry.fb_size.w,
+					                     clip_top, clip_bottom, clip_left, clip_right,
+					                     pixel, fg_alpha);
+				});
+			}
+		}
+
+		/**
+		 * Move pixels of the lines 'start' to 'end' by 'lines' lines upwards
+		 *
+		 * A negative 'lines' value moves the pixels downwards.
+		 *
+		 * \return  rectangle covering the moved pixels
+		 */
+		Rect _move_lines(Surface<PT> &surface, int start, int end, int lines)
+		{
+			int const distance  = (lines > 0) ? lines : -lines,
+			          num_moved = end - start + 1 - distance;
+
+			if (num_moved <= 0)
+				return Rect();
+
+			unsigned const w = _geometry.fb_size.w,
+			               h = _geometry.char_height;
+
+			int const y0    = _geometry.start().y,
+			          dst_y = y0 + h*((lines > 0) ? start : start + distance),
+			          src_y = y0 + h*((lines > 0) ? start + distance : start);
+
+			unsigned const num_rows = num_moved*h;
+
+			PT * const pixels = surface.addr();
+
+			/* source and destination rows do not overlap */
+			auto move_row = [&] (unsigned i) {
+				memcpy(pixels + (dst_y + i)*w, pixels + (src_y + i)*w, w*sizeof(PT)); };
+
+			if (lines > 0)
+				for (unsigned i = 0; i < num_rows; i++) move_row(i);
+			else
+				for (unsigned i = num_rows; i-- > 0; ) move_row(i);
+
+			return Rect(Point(0, dst_y), Area(w, num_rows));
+		}
+
 	public:
 
 		/**
@@ -189,7 +335,9 @@ class Terminal::Text_screen_surface
 			_palette(palette),
 			_geometry(font, initial_fb_size),
 			_cell_array(_geometry.columns, _geometry.lines, alloc)
-		{ }
+		{
+			_cell_array.track_scrolling(true);
+		}
 
 		/**
 		 * Update geometry
@@ -210,7 +358,28 @@ class Terminal::Text_screen_surface
 
 		Rect redraw(Surface<PT> &surface)
 		{
-			unsigned const fg_alpha = 255;
+			/* move the pixels of scrolled lines instead of repainting them */
+			Rect moved { };
+			_cell_array.with_pending_scroll([&] (int start, int end, int lines) {
+				moved = _move_lines(surface, start, end, lines);
+
+				/*
+				 * The pointer and selection highlights stay at their screen
+				 * positions. Repaint the lines they were moved to and the
+				 * lines they must be restored at.
+				 */
+				auto mark_dirty = [&] (int line) {
+					if (line >= start && line <= end)
+						_cell_array.mark_line_as_dirty(line); };
+
+				mark_dirty(_pointer.y);
+				mark_dirty(_pointer.y - lines);
+
+				if (_selection.defined)
+					_selection.for_each_line([&] (int line) {
+						mark_dirty(line);
+						mark_dirty(line - lines); });
+			});
 
 			/* clear border */
 			{
@@ -222,86 +391,12 @@ class Terminal::Text_screen_surface
 					Box_painter::paint(surface, r, bg_color); });
 			}
 
-			int const clip_top  = 0, clip_bottom = _geometry.fb_size.h,
-			          clip_left = 0, clip_right  = _geometry.fb_size.w;
-
 			unsigned y = _geometry.start().y;
 			for (unsigned line = 0; line < _cell_array.num_lines(); line++) {
 
-				if (_cell_array.line_dirty(line)) {
-
-					Fixpoint_number x { (int)_geometry.start().x };
-					for (unsigned column = 0; column < _cell_array.num_cols(); column++) {
-
-						Char_cell const cell = _cell_array.get_cell(column, line);
+				if (_cell_array.line_dirty(line))
+					_paint_line(surface, line, y);
 
-						Codepoint codepoint = cell.codepoint();
-
-						/* display absent codepoints as whitespace */
-						bool const codepoint_valid = (codepoint.value != 0);
-
-						bool const selected = _selection.selected(Position(column, line))
-						                   && codepoint_valid;
-
-						bool const pointer = (_pointer == Position(column, line));
-
-						if (!codepoint_valid)
-							codepoint = Codepoint{' '};
-
-						_font.apply_glyph(codepoint, [&] (Glyph_painter::Glyph const &glyph) {
-
-							Color_palette::Highlighted const highlighted { cell.highlight() };
-
-							Color_palette::Index fg_idx { cell.colidx_fg() };
-							Color_palette::Index bg_idx { cell.colidx_bg() };
-
-							/* swap color index for inverse cells */
-							if (cell.inverse()) {
-								Color_palette::Index tmp { fg_idx };
-								fg_idx = bg_idx;
-								bg_idx = tmp;
-							}
-
-							Color fg_color = _palette.foreground(fg_idx, highlighted);
-							Color bg_color = _palette.background(bg_idx, highlighted);
-
-							if (selected) {
-								bg_color = Color::rgb(180, 180, 180);
-								fg_color = Color::rgb( 50, 50,   50);
-							}
-
-							if (pointer) {
-								bg_color = Color::rgb(220, 220, 220);
-								fg_color = Color::rgb( 50, 50,   50);
-							}
-
-							if (cell.has_cursor()) {
-								fg_color = Color::rgb( 63,  63,  63);
-								bg_color = Color::rgb(255, 255, 255);
-							}
-
-							PT const pixel(fg_color.r, fg_color.g, fg_color.b);
-
-							Fixpoint_number next_x = x;
-							next_x.value += _geometry.char_width.value;
-
-							Box_painter::paint(surface,
-							                   Rect::compound(Point(x.decimal(), y),
-							                                  Point(next_x.decimal() - 1,
-							                                        y + _geometry.char_height - 1)),
-							                   bg_color);
-
-							/* horizontally align glyph within cell */
-							x.value += (_geometry.char_width.value - (int)((glyph.width - 1)<<8)) >> 1;
-
-							Glyph_painter::paint(Glyph_painter::Position(x, (int)y),
-							                     glyph, surface.addr(), _geometry.fb_size.w,
-							                     clip_top, clip_bottom, clip_left, clip_right,
-							                     pixel, fg_alpha);
-							x = next_x;
-						});
-					}
-				}
 				y += _geometry.char_height;
 			}
 
@@ -317,6 +412,8 @@ class Terminal::Text_screen_surface
 				_cell_array.mark_line_as_clean(line);
 			}
 
+			Rect dirty { };
+
 			int const num_dirty_lines = last_dirty_line - first_dirty_line + 1;
 			if (num_dirty_lines > 0) {
 				int      const y = _geometry.start().y
@@ -324,10 +421,13 @@ class Terminal::Text_screen_surface
 				unsigned const h = num_dirty_lines*_geometry.char_height
 				                 + _geometry.unused_pixels().h;
 
-				return Rect(Point(0, y), Area(_geometry.fb_size.w, h));
+				dirty = Rect(Point(0, y), Area(_geometry.fb_size.w, h));
 			}
 
-			return Rect();
+			if (!moved.valid()) return dirty;
+			if (!dirty.valid()) return moved;
+
+			return Rect::compound(dirty, moved);
 		}
 
 		void apply_character(Character c)
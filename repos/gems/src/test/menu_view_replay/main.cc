@@ -0,0 +1,103 @@
+/*
+ * \brief  Replay of a recorded sequence of dialog updates for the menu view
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * The '<dialog>' nodes of the config are reported one after another as
+ * "dialog" report, one per period. The sequence is repeated for the
+ * configured number of rounds.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <os/reporter.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Main;
+}
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	unsigned const _rounds    = _config.node().attribute_value("rounds", 10u);
+	uint64_t const _period_ms = _config.node().attribute_value("period_ms", 20u);
+
+	unsigned const _num_steps = [&] {
+		unsigned n = 0;
+		_config.node().for_each_sub_node("dialog", [&] (Node const &) { n++; });
+		return n; }();
+
+	unsigned _round = 0, _step = 0;
+
+	Expanding_reporter _dialog_reporter { _env, "dialog", "dialog" };
+
+	Timer::Connection _timer { _env };
+
+	Signal_handler<Main> _timeout_handler {
+		_env.ep(), *this, &Main::_handle_timeout };
+
+	void _report_step(unsigned const step)
+	{
+		unsigned i = 0;
+		_config.node().for_each_sub_node("dialog", [&] (Node const &dialog) {
+
+			if (i++ != step)
+				return;
+
+			_dialog_reporter.generate([&] (Generator &g) {
+				g.node_attributes(dialog);
+				if (!g.append_node_content(dialog, { 20 }))
+					warning("dialog ", step, " exceeds maximum depth"); });
+		});
+	}
+
+	void _handle_timeout()
+	{
+		/* leave the last dialog update one period to settle */
+		if (_round == _rounds) {
+			_timer.sigh(Signal_context_capability());
+			log("--- menu_view replay finished ---");
+			return;
+		}
+
+		_report_step(_step);
+
+		if (++_step == _num_steps) {
+			_step = 0;
+			_round++;
+		}
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		if (!_num_steps) {
+			error("config lacks <dialog> nodes to replay");
+			return;
+		}
+
+		log("replay ", _num_steps, " dialog updates in ", _rounds, " rounds, "
+		    "period ", _period_ms, " ms");
+
+		_timer.sigh(_timeout_handler);
+		_timer.trigger_periodic(_period_ms*1000);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,3 @@
+TARGET = test-menu_view_replay
+SRC_CC = main.cc
+LIBS   = base
@@ -0,0 +1,67 @@
+/*
+ * \brief  Linux-compatible epoll interface
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _SYS__EPOLL_H_
+#define _SYS__EPOLL_H_
+
+#include <sys/cdefs.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <stdint.h>
+
+#define EPOLL_CLOEXEC  O_CLOEXEC
+
+#define EPOLLIN        0x001
+#define EPOLLPRI       0x002
+#define EPOLLOUT       0x004
+#define EPOLLERR       0x008
+#define EPOLLHUP       0x010
+#define EPOLLRDNORM    0x040
+#define EPOLLRDBAND    0x080
+#define EPOLLWRNORM    0x100
+#define EPOLLWRBAND    0x200
+#define EPOLLMSG       0x400
+#define EPOLLRDHUP     0x2000
+#define EPOLLONESHOT   (1U << 30)
+#define EPOLLET        (1U << 31)
+
+#define EPOLL_CTL_ADD  1
+#define EPOLL_CTL_DEL  2
+#define EPOLL_CTL_MOD  3
+
+typedef union epoll_data {
+	void     *ptr;
+	int       fd;
+	uint32_t  u32;
+	uint64_t  u64;
+} epoll_data_t;
+
+struct epoll_event {
+	uint32_t     events;
+	epoll_data_t data;
+}
+#ifdef __x86_64__
+__attribute__((packed))
+#endif
+;
+
+__BEGIN_DECLS
+
+int epoll_create(int);
+int epoll_create1(int);
+int epoll_ctl(int, int, int, struct epoll_event *);
+int epoll_wait(int, struct epoll_event *, int, int);
+
+__END_DECLS
+
+#endif /* _SYS__EPOLL_H_ */
@@ -0,0 +1,493 @@
+/*
+ * \brief  epoll implementation
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Libc includes */
+#include <sys/epoll.h>
+#include <sys/poll.h>
+#include <stdlib.h>
+
+/* internal includes */
+#include <internal/errno.h>
+#include <internal/fd_alloc.h>
+#include <internal/file.h>
+#include <internal/init.h>
+#include <internal/monitor.h>
+#include <internal/plugin_registry.h>
+#include <internal/signal.h>
+#include <internal/epoll.h>
+
+/* Genode includes */
+#include <base/mutex.h>
+#include <base/registry.h>
+#include <util/avl_tree.h>
+
+using namespace Libc;
+
+namespace Libc { struct Epoll; }
+
+
+static Monitor                       *_monitor_ptr;
+static Libc::Signal                  *_signal_ptr;
+static Libc::Epoll_plugin            *_epoll_plugin_ptr;
+static Genode::Registry<Libc::Epoll> *_epolls_ptr;
+
+
+/*
+ * Epoll backend implementation
+ *
+ * The interest set is kept across 'epoll_wait' calls. For each wakeup, the
+ * registered file descriptors are handed to their plugins' 'poll' method
+ * as a prepared array that is rebuilt only if the interest set changes.
+ *
+ * Edge-triggered mode (EPOLLET) reports a file descriptor once when it
+ * becomes ready. It is reported again after it was observed not ready or
+ * after a read or write on it returned EAGAIN. Data arriving at an already
+ * readable file descriptor does not trigger another event.
+ *
+ * A file descriptor with EPOLLONESHOT is disarmed after its first event
+ * and is not polled until it is re-armed by EPOLL_CTL_MOD.
+ */
+struct Libc::Epoll : Genode::Noncopyable
+{
+	struct Element : Avl_node<Element>
+	{
+		int const        libc_fd;
+		File_descriptor &fdo;
+		epoll_event      event;
+
+		short revents  = 0;      /* result of the most recent poll */
+		bool  armed    = true;   /* cleared by an EPOLLONESHOT event */
+		bool  reported = false;  /* readiness was reported (EPOLLET) */
+
+		/* 'fdo.eagain_count' at the time of the last report (EPOLLET) */
+		unsigned long eagain_count = 0;
+
+		Element(File_descriptor &fdo, epoll_event const &event)
+		: libc_fd(fdo.libc_fd), fdo(fdo), event(event) { }
+
+		bool new_edge() const
+		{
+			return !reported || eagain_count != fdo.eagain_count;
+		}
+
+		bool higher(Element *e) { return e->libc_fd > libc_fd; }
+
+		Element *find(int fd)
+		{
+			if (fd == libc_fd) return this;
+			Element *e = child(fd > libc_fd);
+			return e ? e->find(fd) : nullptr;
+		}
+
+		short poll_events() const
+		{
+			short result = 0;
+			if (event.events & (EPOLLIN | EPOLLRDNORM))  result |= POLLIN;
+			if (event.events & (EPOLLPRI | EPOLLRDBAND)) result |= POLLPRI;
+			if (event.events & (EPOLLOUT | EPOLLWRNORM)) result |= POLLOUT;
+			return result;
+		}
+
+		uint32_t epoll_events() const
+		{
+			uint32_t result = 0;
+			if (revents & (POLLIN | POLLPRI)) result |= event.events & (EPOLLIN | EPOLLRDNORM);
+			if (revents & POLLOUT)            result |= event.events & (EPOLLOUT | EPOLLWRNORM);
+			if (revents & POLLERR)            result |= EPOLLERR;
+			if (revents & POLLHUP)            result |= EPOLLHUP;
+			return result;
+		}
+	};
+
+	Genode::Allocator &_alloc;
+
+	Registry<Epoll>::Element _registry_elem;
+
+	Mutex             _mutex    { };   /* protect '_elements' and '_poll' */
+	Avl_tree<Element> _elements { };
+	unsigned          _count    = 0;
+
+	/*
+	 * Arguments for the plugins' 'poll' methods
+	 *
+	 * The entries are grouped by plugin such that each plugin is called
+	 * once per wakeup with a contiguous part of the array.
+	 */
+	struct Poll_array
+	{
+		Plugin::Pollfd  *pollfds  = nullptr;
+		Element        **elements = nullptr;
+		unsigned         capacity = 0;
+		unsigned         count    = 0;
+		unsigned         next     = 0;   /* first entry to report, for fairness */
+		bool             outdated = true;
+	} _poll { };
+
+	void _for_each_element(auto const &fn)
+	{
+		_elements.for_each([&] (Element const &e) {
+			fn(const_cast<Element &>(e)); });
+	}
+
+	Element *_lookup(int libc_fd)
+	{
+		return _elements.first() ? _elements.first()->find(libc_fd) : nullptr;
+	}
+
+	void _destroy(Element &e)
+	{
+		_elements.remove(&e);
+		destroy(_alloc, &e);
+		_count--;
+		_poll.outdated = true;
+	}
+
+	void _free_poll_array()
+	{
+		if (!_poll.capacity)
+			return;
+
+		_alloc.free(_poll.pollfds,  sizeof(Plugin::Pollfd)*_poll.capacity);
+		_alloc.free(_poll.elements, sizeof(Element *)*_poll.capacity);
+		_poll = { };
+	}
+
+	void _update_poll_array()
+	{
+		if (!_poll.outdated)
+			return;
+
+		if (_poll.capacity < _count) {
+			unsigned const capacity = max(_count, 2*_poll.capacity);
+			_free_poll_array();
+			_poll.pollfds  = (Plugin::Pollfd *)_alloc.alloc(sizeof(Plugin::Pollfd)*capacity);
+			_poll.elements = (Element **)_alloc.alloc(sizeof(Element *)*capacity);
+			_poll.capacity = capacity;
+		}
+
+		_poll.count = 0;
+		plugin_registry()->for_each_plugin([&] (Plugin &plugin) {
+			_for_each_element([&] (Element &e) {
+				if (e.fdo.plugin != &plugin || !e.armed)
+					return;
+
+				_poll.pollfds [_poll.count] = { &e.fdo, e.poll_events(), &e.revents };
+				_poll.elements[_poll.count] = &e;
+				_poll.count++;
+			});
+		});
+
+		_poll.next     = 0;
+		_poll.outdated = false;
+	}
+
+	/**
+	 * Poll all registered file descriptors and report up to 'max_events' events
+	 */
+	int _collect(epoll_event *events, int max_events)
+	{
+		Mutex::Guard guard(_mutex);
+
+		_update_poll_array();
+
+		for (unsigned i = 0; i < _poll.count; i++)
+			*_poll.pollfds[i].revents = 0;
+
+		for (unsigned first = 0, n = 0; first < _poll.count; first += n) {
+
+			Plugin &plugin = *_poll.pollfds[first].fdo->plugin;
+
+			for (n = 1; first + n < _poll.count; n++)
+				if (_poll.pollfds[first + n].fdo->plugin != &plugin)
+					break;
+
+			plugin.poll(&_poll.pollfds[first], n);
+		}
+
+		int num_events = 0;
+
+		for (unsigned j = 0; j < _poll.count; j++) {
+
+			unsigned const i = (_poll.next + j) % _poll.count;
+			Element &e = *_poll.elements[i];
+
+			if (!e.revents) {
+				e.reported = false;
+				continue;
+			}
+
+			if (num_events == max_events)
+				continue;
+
+			if ((e.event.events & EPOLLET) && !e.new_edge())
+				continue;
+
+			events[num_events].events = e.epoll_events();
+			events[num_events].data   = e.event.data;
+			num_events++;
+
+			e.reported     = true;
+			e.eagain_count = e.fdo.eagain_count;
+
+			/* exclude the element from polling until re-armed by EPOLL_CTL_MOD */
+			if (e.event.events & EPOLLONESHOT) {
+				e.armed        = false;
+				_poll.outdated = true;
+			}
+
+			_poll.next = (i + 1) % _poll.count;
+		}
+
+		return num_events;
+	}
+
+	Epoll(Genode::Allocator &alloc, Registry<Epoll> &registry)
+	: _alloc(alloc), _registry_elem(registry, *this) { }
+
+	~Epoll()
+	{
+		while (Element *e = _elements.first())
+			_destroy(*e);
+
+		_free_poll_array();
+	}
+
+	int ctl(int op, File_descriptor &fdo, epoll_event const *event)
+	{
+		if (op != EPOLL_CTL_DEL && !event)
+			return Errno(EFAULT);
+
+		Mutex::Guard guard(_mutex);
+
+		Element *e = _lookup(fdo.libc_fd);
+
+		switch (op) {
+
+		case EPOLL_CTL_ADD:
+
+			if (e)
+				return Errno(EEXIST);
+
+			_elements.insert(new (_alloc) Element(fdo, *event));
+			_count++;
+			break;
+
+		case EPOLL_CTL_MOD:
+
+			if (!e)
+				return Errno(ENOENT);
+
+			e->event    = *event;
+			e->armed    = true;
+			e->reported = false;
+			break;
+
+		case EPOLL_CTL_DEL:
+
+			if (!e)
+				return Errno(ENOENT);
+
+			_destroy(*e);
+			break;
+
+		default:
+			return Errno(EINVAL);
+		}
+
+		_poll.outdated = true;
+		return 0;
+	}
+
+	/**
+	 * Remove element of file descriptor that is about to be freed
+	 */
+	void forget(File_descriptor &fdo)
+	{
+		Mutex::Guard guard(_mutex);
+
+		Element *e = _lookup(fdo.libc_fd);
+		if (e && &e->fdo == &fdo)
+			_destroy(*e);
+	}
+
+	int wait(epoll_event *events, int max_events, int timeout_ms)
+	{
+		int num_events = _collect(events, max_events);
+
+		if (num_events || timeout_ms == 0)
+			return num_events;
+
+		/* convert infinite timeout to monitor interface */
+		if (timeout_ms < 0)
+			timeout_ms = 0;
+
+		unsigned const orig_signal_count = _signal_ptr->count();
+
+		auto signal_occurred_during_wait = [&] () {
+			return (_signal_ptr->count() != orig_signal_count); };
+
+		auto monitor_fn = [&] ()
+		{
+			num_events = _collect(events, max_events);
+
+			if (num_events || signal_occurred_during_wait())
+				return Monitor::Function_result::COMPLETE;
+
+			return Monitor::Function_result::INCOMPLETE;
+		};
+
+		Monitor::Result const monitor_result =
+			_monitor_ptr->monitor(monitor_fn, timeout_ms);
+
+		if (monitor_result == Monitor::Result::TIMEOUT)
+			return 0;
+
+		if (!num_events && signal_occurred_during_wait())
+			return Errno(EINTR);
+
+		return num_events;
+	}
+};
+
+
+void Libc::init_epoll(Genode::Allocator &alloc, Signal &signal, Monitor &monitor,
+                      File_descriptor_allocator &fd_alloc)
+{
+	_epoll_plugin_ptr = new (alloc) Epoll_plugin(alloc);
+	_epolls_ptr       = new (alloc) Registry<Epoll>();
+	_signal_ptr       = &signal;
+	_monitor_ptr      = &monitor;
+	_fd_alloc_ptr     = &fd_alloc;
+}
+
+
+static Epoll_plugin *epoll_plugin()
+{
+	if (!_epoll_plugin_ptr) {
+		error("libc epoll not initialized - aborting");
+		exit(1);
+	}
+
+	return _epoll_plugin_ptr;
+}
+
+
+void Libc::epoll_forget(File_descriptor &fdo)
+{
+	if (_epolls_ptr)
+		_epolls_ptr->for_each([&] (Epoll &ep) { ep.forget(fdo); });
+}
+
+
+void Libc::epoll_rearm(int libc_fd)
+{
+	if (!_epolls_ptr)
+		return;
+
+	if (File_descriptor *fdo = file_descriptor_allocator()->find_by_libc_fd(libc_fd))
+		fdo->eagain_count++;
+}
+
+
+int Libc::Epoll_plugin::create_epoll(int flags)
+{
+	Epoll *ep = new (_alloc) Epoll(_alloc, *_epolls_ptr);
+
+	Plugin_context *context = reinterpret_cast<Libc::Plugin_context *>(ep);
+	File_descriptor *fd =
+		file_descriptor_allocator()->alloc(this, context, Libc::ANY_FD);
+
+	fd->cloexec = (flags & EPOLL_CLOEXEC);
+
+	return fd->libc_fd;
+}
+
+
+int Libc::Epoll_plugin::close(File_descriptor *fd)
+{
+	if (fd->plugin != this)
+		return -1;
+
+	if (fd->context)
+		destroy(_alloc, reinterpret_cast<Epoll *>(fd->context));
+
+	file_descriptor_allocator()->free(fd);
+
+	return 0;
+}
+
+
+static Epoll *epoll_by_libc_fd(int libc_fd)
+{
+	File_descriptor *fd = file_descriptor_allocator()->find_by_libc_fd(libc_fd);
+
+	if (!fd || fd->plugin != epoll_plugin())
+		return nullptr;
+
+	return reinterpret_cast<Epoll *>(fd->context);
+}
+
+
+extern "C" int epoll_create1(int flags)
+{
+	if (flags & ~EPOLL_CLOEXEC)
+		return Errno(EINVAL);
+
+	return epoll_plugin()->create_epoll(flags);
+}
+
+
+extern "C" int epoll_create(int size)
+{
+	if (size <= 0)
+		return Errno(EINVAL);
+
+	return epoll_create1(0);
+}
+
+
+extern "C" int epoll_ctl(int epfd, int op, int libc_fd, struct epoll_event *event)
+{
+	File_descriptor *epoll_fd = file_descriptor_allocator()->find_by_libc_fd(epfd);
+	File_descriptor *fd       = file_descriptor_allocator()->find_by_libc_fd(libc_fd);
+
+	if (!epoll_fd || !fd || !fd->plugin)
+		return Errno(EBADF);
+
+	Epoll *ep = epoll_by_libc_fd(epfd);
+	if (!ep || fd == epoll_fd)
+		return Errno(EINVAL);
+
+	/* epoll(7): file descriptors that cannot be polled are rejected */
+	if (!fd->plugin->supports_poll())
+		return Errno(EPERM);
+
+	return ep->ctl(op, *fd, event);
+}
+
+
+extern "C" int epoll_wait(int epfd, struct epoll_event *events,
+                          int maxevents, int timeout_ms)
+{
+	if (!file_descriptor_allocator()->find_by_libc_fd(epfd))
+		return Errno(EBADF);
+
+	Epoll *ep = epoll_by_libc_fd(epfd);
+	if (!ep || maxevents <= 0)
+		return Errno(EINVAL);
+
+	if (!events)
+		return Errno(EFAULT);
+
+	return ep->wait(events, maxevents, timeout_ms);
+}
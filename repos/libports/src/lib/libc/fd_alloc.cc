@@ -22,6 +22,7 @@
 #include <unistd.h>
 
 /* libc-internal includes */
+#include <internal/epoll.h>
 #include <internal/fd_alloc.h>
 #include <internal/init.h>
 
@@ -66,6 +67,9 @@ File_descriptor *File_descriptor_allocator::alloc(Plugin *plugin,
 
 void File_descriptor_allocator::free(File_descriptor *fdo)
 {
+	/* epoll(7): closing a file descriptor removes it from all interest lists */
+	epoll_forget(*fdo);
+
 	Mutex::Guard guard(_mutex);
 
 	if (fdo->fd_path)
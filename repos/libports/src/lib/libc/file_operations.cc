@@ -40,6 +40,7 @@ extern "C" {
 /* libc-internal includes */
 #include <internal/plugin_registry.h>
 #include <internal/plugin.h>
+#include <internal/epoll.h>
 #include <internal/file.h>
 #include <internal/file_operations.h>
 #include <internal/mem_alloc.h>
@@ -662,7 +663,9 @@ extern "C" int pipe2(int pipefd[2], int flags)
 
 
 __SYS_(ssize_t, read, (int libc_fd, void *buf, ::size_t count), {
-	FD_FUNC_WRAPPER(read, libc_fd, buf, count); })
+	ssize_t result;
+	FD_FUNC_WRAPPER_GENERIC(result =, INVALID_FD, read, libc_fd, buf, count);
+	return epoll_rearm_on_eagain(libc_fd, result); })
 
 
 extern "C" ssize_t readlink(const char *path, char *buf, ::size_t bufsiz)
@@ -793,7 +796,9 @@ __SYS_(ssize_t, write, (int libc_fd, const void *buf, ::size_t count),
 	if ((flags != -1) && (flags & O_APPEND))
 		lseek(libc_fd, 0, SEEK_END);
 
-	FD_FUNC_WRAPPER(write, libc_fd, buf, count);
+	ssize_t result;
+	FD_FUNC_WRAPPER_GENERIC(result =, INVALID_FD, write, libc_fd, buf, count);
+	return epoll_rearm_on_eagain(libc_fd, result);
 })
 
 
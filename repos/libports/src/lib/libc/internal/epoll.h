@@ -0,0 +1,77 @@
+/*
+ * \brief  epoll plugin interface
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _LIBC__INTERNAL__EPOLL_H_
+#define _LIBC__INTERNAL__EPOLL_H_
+
+/* Libc includes */
+#include <errno.h>
+#include <sys/epoll.h>
+
+#include <base/allocator.h>
+#include <internal/plugin.h>
+
+namespace Libc {
+
+	class Epoll_plugin;
+
+	struct File_descriptor;
+
+	/**
+	 * Remove file descriptor from all epoll interest lists
+	 *
+	 * Called by the file-descriptor allocator before the file descriptor
+	 * is freed.
+	 */
+	void epoll_forget(File_descriptor &);
+
+	/**
+	 * Start a new edge for edge-triggered epoll events of 'libc_fd'
+	 */
+	void epoll_rearm(int libc_fd);
+
+	/**
+	 * Re-arm EPOLLET events if an I/O operation returned EAGAIN
+	 *
+	 * epoll(7) expects applications to wait for the next event only
+	 * after read or write returned EAGAIN. Data arriving afterwards must
+	 * be reported even if the file descriptor was not observed idle in
+	 * between.
+	 *
+	 * \return  'result' as is
+	 */
+	auto epoll_rearm_on_eagain(int libc_fd, auto result)
+	{
+		if (result == -1 && errno == EAGAIN)
+			epoll_rearm(libc_fd);
+
+		return result;
+	}
+}
+
+
+class Libc::Epoll_plugin : public Libc::Plugin
+{
+	private:
+
+		Genode::Allocator &_alloc;
+
+	public:
+
+		Epoll_plugin(Genode::Allocator &alloc) : _alloc(alloc) { }
+
+		int create_epoll(int flags);
+		int close(File_descriptor *) override;
+};
+
+#endif /* _LIBC__INTERNAL__EPOLL_H_ */
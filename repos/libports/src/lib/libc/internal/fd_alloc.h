@@ -62,6 +62,9 @@ struct Libc::File_descriptor
 	Plugin         *plugin;
 	Plugin_context *context;
 
+	/* incremented whenever an I/O operation returned EAGAIN, for EPOLLET */
+	unsigned long eagain_count = 0;
+
 	struct Aio_handle
 	{
 		enum class State { INVALID, QUEUED, COMPLETE };
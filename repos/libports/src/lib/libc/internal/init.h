@@ -157,6 +157,11 @@ namespace Libc {
 	 */
 	void init_kqueue(Genode::Allocator &, Monitor &, File_descriptor_allocator &);
 
+	/**
+	 * Epoll support
+	 */
+	void init_epoll(Genode::Allocator &, Signal &, Monitor &, File_descriptor_allocator &);
+
 	/**
 	 * Random-number support
 	 */
@@ -80,12 +80,56 @@ class Libc::Malloc
 		using addr_t = Genode::addr_t;
 
 		enum {
-			SLAB_START    = 5,  /* 32 bytes (log2) */
-			SLAB_STOP     = 11, /* 2048 bytes (log2) */
-			NUM_SLABS     = (SLAB_STOP - SLAB_START) + 1,
+			SLAB_MIN      = 32, /* smallest size class in bytes */
+			SLAB_MAX_LOG2 = 12, /* 4096 bytes */
+			SLAB_MAX      = 1 << SLAB_MAX_LOG2,
 			DEFAULT_ALIGN = 16
 		};
 
+		/*
+		 * Size classes
+		 *
+		 * Up to 128 bytes, the classes are spaced by 16 bytes. Above, each
+		 * power-of-two interval is divided into four classes. This bounds the
+		 * internal fragmentation to 25% instead of 100% with power-of-two
+		 * classes.
+		 */
+
+		static constexpr unsigned LINEAR_CLASSES  = 7;  /* 32 ... 128 */
+		static constexpr unsigned LINEAR_MAX_LOG2 = 7;
+		static constexpr unsigned NUM_CLASSES     = LINEAR_CLASSES
+		                                          + 4*(SLAB_MAX_LOG2 - LINEAR_MAX_LOG2);
+
+		static constexpr unsigned _log2(size_t value)
+		{
+			return unsigned(8*sizeof(value) - 1 - __builtin_clzl(value));
+		}
+
+		static constexpr unsigned _class_index(size_t size)
+		{
+			if (size <= SLAB_MIN)
+				return 0;
+
+			if (size <= (1U << LINEAR_MAX_LOG2))
+				return unsigned((size + 15)/16 - 2);
+
+			unsigned const msb     = _log2(size - 1);
+			size_t   const quarter = (size - 1 - (1UL << msb)) >> (msb - 2);
+
+			return LINEAR_CLASSES + (msb - LINEAR_MAX_LOG2)*4 + unsigned(quarter);
+		}
+
+		static constexpr size_t _class_size(unsigned index)
+		{
+			if (index < LINEAR_CLASSES)
+				return SLAB_MIN + 16*index;
+
+			unsigned const msb     = LINEAR_MAX_LOG2 + (index - LINEAR_CLASSES)/4;
+			unsigned const quarter = (index - LINEAR_CLASSES) % 4;
+
+			return (1UL << msb) + (quarter + 1)*(1UL << (msb - 2));
+		}
+
 		struct Metadata
 		{
 			size_t size;
@@ -121,31 +165,35 @@ class Libc::Malloc
 
 		Allocator &_backing_store; /* back-end allocator */
 
-		Constructible<Slab_alloc> _slabs[NUM_SLABS]; /* slab allocators */
-
-		Mutex _mutex;
-
-		unsigned _slab_log2(size_t size) const
+		/*
+		 * Each size class is protected by a mutex of its own so that threads
+		 * allocating objects of different sizes do not serialize. Requests
+		 * larger than the largest class are passed to the thread-safe
+		 * backing store without taking any lock of the allocator.
+		 *
+		 * The backing store is the malloc heap of the libc kernel, which
+		 * already places big allocations (64 KiB or more) in dataspaces of
+		 * their own. Being regions of the malloc heap, those dataspaces are
+		 * cloned on fork. Hence, large requests are not served from
+		 * dedicated dataspaces here.
+		 */
+		struct Size_class
 		{
-			unsigned msb = Genode::log2(size);
-
-			/* size is greater than msb */
-			if (size > (1U << msb))
-				msb++;
-
-			/* use smallest slab */
-			if (size < (1U << SLAB_START))
-				msb = SLAB_START;
+			Constructible<Slab_alloc> slab { };
+			Mutex                     mutex { };
+		};
 
-			return msb;
-		}
+		Size_class _classes[NUM_CLASSES];
 
 	public:
 
 		Malloc(Allocator &backing_store) : _backing_store(backing_store)
 		{
-			for (unsigned i = SLAB_START; i <= SLAB_STOP; i++)
-				_slabs[i - SLAB_START].construct(1U << i, backing_store);
+			static_assert(_class_size(NUM_CLASSES - 1) == SLAB_MAX);
+			static_assert(_class_index(SLAB_MAX) == NUM_CLASSES - 1);
+
+			for (unsigned i = 0; i < NUM_CLASSES; i++)
+				_classes[i].slab.construct(_class_size(i), backing_store);
 		}
 
 		~Malloc() { warning(__func__, " unexpectedly called"); }
@@ -156,21 +204,22 @@ class Libc::Malloc
 
 		void * alloc(size_t size, size_t align = DEFAULT_ALIGN)
 		{
-			Mutex::Guard guard(_mutex);
-
-			size_t   const real_size = size + _room(align);
-			unsigned const msb       = _slab_log2(real_size);
+			size_t const real_size = size + _room(align);
 
 			void *alloc_addr = nullptr;
 
 			/* use backing store if requested memory is larger than largest slab */
-			if (msb > SLAB_STOP)
+			if (real_size > SLAB_MAX)
 				_backing_store.try_alloc(real_size).with_result(
 					[&] (Range_allocator::Allocation &a) {
 						a.deallocate = false; alloc_addr = a.ptr; },
 					[&] (Alloc_error) { });
-			else
-				alloc_addr = _slabs[msb - SLAB_START]->alloc();
+			else {
+				Size_class &c = _classes[_class_index(real_size)];
+
+				Mutex::Guard guard(c.mutex);
+				alloc_addr = c.slab->alloc();
+			}
 
 			if (!alloc_addr) return nullptr;
 
@@ -210,12 +259,9 @@ class Libc::Malloc
 
 		void free(void *ptr)
 		{
-			Mutex::Guard lock_guard(_mutex);
-
 			Metadata *md = (Metadata *)ptr - 1;
 
-			size_t   const  real_size  = md->size;
-			unsigned const  msb        = _slab_log2(real_size);
+			size_t const real_size = md->size;
 
 			void *alloc_addr = (void *)((addr_t)ptr - md->offset);
 
@@ -223,10 +269,13 @@ class Libc::Malloc
 				error("libc free: meta-data offset is 0 for address: ", ptr,
 				      " - corrupted allocation");
 
-			if (msb > SLAB_STOP) {
+			if (real_size > SLAB_MAX) {
 				_backing_store.free(alloc_addr, real_size);
 			} else {
-				_slabs[msb - SLAB_START]->dealloc(alloc_addr);
+				Size_class &c = _classes[_class_index(real_size)];
+
+				Mutex::Guard guard(c.mutex);
+				c.slab->dealloc(alloc_addr);
 			}
 		}
 };
@@ -15,6 +15,8 @@
 /* Genode includes */
 #include <base/log.h>
 #include <base/thread.h>
+#include <cpu/atomic.h>
+#include <cpu/memory_barrier.h>
 #include <util/list.h>
 #include <libc/allocator.h>
 
@@ -211,33 +213,78 @@ namespace Libc {
 struct pthread_mutex_attr { pthread_mutextype type; };
 
 
+/**
+ * Call 'fn' with a blockade suitable for the calling context
+ */
+static auto with_blockade(Libc::uint64_t timeout_ms, auto const &fn)
+{
+	struct Missing_call_of_init_pthread_support : Exception { };
+
+	if (Libc::Kernel::kernel().main_context()) {
+		Main_blockade blockade { timeout_ms };
+		return fn(blockade);
+	}
+
+	if (!_timer_accessor_ptr)
+		throw Missing_call_of_init_pthread_support();
+
+	Pthread_blockade blockade { *_timer_accessor_ptr, timeout_ms };
+	return fn(blockade);
+}
+
+
 /*
  * This class is named 'struct pthread_mutex' because the 'pthread_mutex_t'
  * type is defined as 'struct pthread_mutex *' in '_pthreadtypes.h'
+ *
+ * The lock state is kept in an atomic word. Uncontended lock and unlock
+ * operations are a single compare-and-exchange each. Before blocking, a
+ * locker spins for a bounded number of iterations, which is adapted to the
+ * observed hold times of the mutex. Only if applicants are enqueued, the
+ * unlock operation takes '_data_mutex' to hand over the mutex.
  */
 class pthread_mutex : Genode::Noncopyable
 {
-	private:
+	public:
 
 		struct Applicant : Genode::Noncopyable
-	{
-		pthread_t const thread;
+		{
+			pthread_t const thread;
 
-		Applicant *next { nullptr };
+			Applicant *next { nullptr };
 
-		Libc::Blockade &blockade;
+			Libc::Blockade &blockade;
 
-		Applicant(pthread_t thread, Libc::Blockade &blockade)
-		: thread(thread), blockade(blockade)
-		{ }
-	};
+			Applicant(pthread_t thread, Libc::Blockade &blockade)
+			: thread(thread), blockade(blockade)
+			{ }
+		};
 
-		Applicant *_applicants { nullptr };
+	private:
 
-	protected:
+		/*
+		 * The mutex is CONTENDED whenever applicants are enqueued. A mutex
+		 * in state LOCKED is released without taking '_data_mutex'.
+		 */
+		enum State { UNLOCKED, LOCKED, CONTENDED };
 
-		pthread_t _owner      { nullptr };
-		Mutex     _data_mutex;
+		enum { SPIN_MIN = 10, SPIN_MAX = 100 };
+
+		int volatile _state         { UNLOCKED };
+		int          _spin_estimate { 0 };
+
+		Applicant *_applicants { nullptr };
+
+		static void _cpu_relax()
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			asm volatile ("pause" ::: "memory");
+#elif defined(__aarch64__) || defined(__arm__)
+			asm volatile ("yield" ::: "memory");
+#else
+			Genode::memory_barrier();
+#endif
+		}
 
 		/* _data_mutex must be hold when calling the following methods */
 
@@ -259,14 +306,19 @@ class pthread_mutex : Genode::Noncopyable
 			*a = applicant->next;
 		}
 
-		void _next_applicant_to_owner()
+		/**
+		 * Acquire free mutex or mark it as contended
+		 *
+		 * Return true if the mutex was acquired.
+		 */
+		bool _acquire_or_contend()
 		{
-			if (Applicant *next = _applicants) {
-				_remove_applicant(next);
-				_owner = next->thread;
-				next->blockade.wakeup();
-			} else {
-				_owner = nullptr;
+			for (;;) {
+				if (Genode::cmpxchg(&_state, UNLOCKED, LOCKED))
+					return true;
+
+				if (_state == CONTENDED || Genode::cmpxchg(&_state, LOCKED, CONTENDED))
+					return false;
 			}
 		}
 
@@ -290,28 +342,90 @@ class pthread_mutex : Genode::Noncopyable
 			}
 		}
 
-		struct Missing_call_of_init_pthread_support : Exception { };
+	protected:
+
+		pthread_t _owner      { nullptr };
+		Mutex     _data_mutex;
 
-		Timer_accessor & _timer_accessor()
+		/**
+		 * Acquire the mutex if it is free, without blocking
+		 */
+		bool _try_acquire(pthread_t thread)
 		{
-			if (!_timer_accessor_ptr)
-				throw Missing_call_of_init_pthread_support();
-			return *_timer_accessor_ptr;
+			if (!Genode::cmpxchg(&_state, UNLOCKED, LOCKED))
+				return false;
+
+			_owner = thread;
+			return true;
 		}
 
 		/**
-		 * Enqueue current context as applicant for mutex
+		 * Spin until the mutex becomes free or the spin limit is reached
+		 *
+		 * The limit follows the number of iterations needed on recent
+		 * contention. A failed spin counts as zero iterations, so that the
+		 * limit of mutexes with long critical sections decays toward
+		 * 'SPIN_MIN' and quickly stops wasting CPU time.
+		 */
+		bool _spin_acquire(pthread_t thread)
+		{
+			int const limit = Genode::min(2*_spin_estimate + SPIN_MIN, (int)SPIN_MAX);
+
+			int count = 0;
+			for (; count < limit; count++) {
+				if (_state == UNLOCKED && _try_acquire(thread))
+					break;
+				_cpu_relax();
+			}
+
+			bool const acquired = count < limit;
+
+			_spin_estimate += ((acquired ? count : 0) - _spin_estimate)/8;
+
+			return acquired;
+		}
+
+		/**
+		 * Acquire the mutex, blocking if needed
 		 *
 		 * Return true if mutex was acquired, false on timeout expiration.
 		 */
-		bool _apply_for_mutex(pthread_t thread, Libc::uint64_t timeout_ms)
+		bool _acquire(pthread_t thread, Libc::uint64_t timeout_ms)
 		{
-			if (Libc::Kernel::kernel().main_context()) {
-				Main_blockade blockade { timeout_ms };
-				return _applicant_for_mutex(thread, blockade);
+			if (_try_acquire(thread) || _spin_acquire(thread))
+				return true;
+
+			Mutex::Guard guard(_data_mutex);
+
+			if (_acquire_or_contend()) {
+				_owner = thread;
+				return true;
+			}
+
+			return with_blockade(timeout_ms, [&] (Libc::Blockade &blockade) {
+				return _applicant_for_mutex(thread, blockade); });
+		}
+
+		/**
+		 * Release the mutex, handing it over to the next applicant if any
+		 */
+		void _release()
+		{
+			_owner = nullptr;
+
+			if (Genode::cmpxchg(&_state, LOCKED, UNLOCKED))
+				return;
+
+			Mutex::Guard guard(_data_mutex);
+
+			if (Applicant *next = _applicants) {
+				_remove_applicant(next);
+				_owner = next->thread;
+				_state = _applicants ? CONTENDED : LOCKED;
+				next->blockade.wakeup();
 			} else {
-				Pthread_blockade blockade { _timer_accessor(), timeout_ms };
-				return _applicant_for_mutex(thread, blockade);
+				Genode::memory_barrier();
+				_state = UNLOCKED;
 			}
 		}
 
@@ -330,33 +444,50 @@ class pthread_mutex : Genode::Noncopyable
 		virtual int timedlock(timespec const &) = 0;
 		virtual int trylock()                   = 0;
 		virtual int unlock()                    = 0;
-};
 
+		/**
+		 * Transfer a woken-up condition-variable waiter to the mutex
+		 *
+		 * If the mutex is free, the applicant becomes the owner and is
+		 * woken up right away. Otherwise, it is enqueued and obtains the
+		 * mutex on unlock, which avoids a wakeup of the waiter just for
+		 * blocking on the mutex again (wait morphing).
+		 */
+		void requeue(Applicant &applicant)
+		{
+			Mutex::Guard guard(_data_mutex);
 
-struct Libc::Pthread_mutex_normal : pthread_mutex
-{
-	/* unsynchronized try */
-	int _try_lock(pthread_t thread)
-	{
-		if (!_owner) {
-			_owner = thread;
-			return 0;
+			if (_acquire_or_contend()) {
+				_owner = applicant.thread;
+				applicant.blockade.wakeup();
+			} else {
+				_append_applicant(&applicant);
+			}
 		}
 
-		return EBUSY;
-	}
+		/**
+		 * Withdraw requeued applicant after its blockade returned
+		 *
+		 * Return true if the mutex was handed over to the applicant.
+		 */
+		bool withdraw(Applicant &applicant)
+		{
+			Mutex::Guard guard(_data_mutex);
 
-	int lock() override final
-	{
-		pthread_t const myself = pthread_self();
+			if (applicant.blockade.woken_up())
+				return true;
 
-		Mutex::Guard guard(_data_mutex);
+			_remove_applicant(&applicant);
+			return false;
+		}
+};
 
-		/* fast path without lock contention */
-		if (_try_lock(myself) == 0)
-			return 0;
 
-		_apply_for_mutex(myself, 0);
+struct Libc::Pthread_mutex_normal : pthread_mutex
+{
+	int lock() override final
+	{
+		_acquire(pthread_self(), 0);
 
 		return 0;
 	}
@@ -365,10 +496,8 @@ struct Libc::Pthread_mutex_normal : pthread_mutex
 	{
 		pthread_t const myself = pthread_self();
 
-		Mutex::Guard guard(_data_mutex);
-
 		/* fast path without lock contention - does not check abstimeout according to spec */
-		if (_try_lock(myself) == 0)
+		if (_try_acquire(myself))
 			return 0;
 
 		timespec abs_now;
@@ -378,7 +507,7 @@ struct Libc::Pthread_mutex_normal : pthread_mutex
 		if (!timeout_ms)
 			return ETIMEDOUT;
 
-		if (_apply_for_mutex(myself, timeout_ms))
+		if (_acquire(myself, timeout_ms))
 			return 0;
 		else
 			return ETIMEDOUT;
@@ -386,21 +515,15 @@ struct Libc::Pthread_mutex_normal : pthread_mutex
 
 	int trylock() override final
 	{
-		pthread_t const myself = pthread_self();
-
-		Mutex::Guard guard(_data_mutex);
-
-		return _try_lock(myself);
+		return _try_acquire(pthread_self()) ? 0 : EBUSY;
 	}
 
 	int unlock() override final
 	{
-		Mutex::Guard guard(_data_mutex);
-
 		if (_owner != pthread_self())
 			return EPERM;
 
-		_next_applicant_to_owner();
+		_release();
 
 		return 0;
 	}
@@ -409,29 +532,15 @@ struct Libc::Pthread_mutex_normal : pthread_mutex
 
 struct Libc::Pthread_mutex_errorcheck : pthread_mutex
 {
-	/* unsynchronized try */
-	int _try_lock(pthread_t thread)
-	{
-		if (!_owner) {
-			_owner = thread;
-			return 0;
-		}
-
-		return _owner == thread ? EDEADLK : EBUSY;
-	}
-
 	int lock() override final
 	{
 		pthread_t const myself = pthread_self();
 
-		Mutex::Guard guard(_data_mutex);
-
-		/* fast path without lock contention (or deadlock) */
-		int const result = _try_lock(myself);
-		if (!result || result == EDEADLK)
-			return result;
+		/* only the owner itself can observe '_owner == myself' */
+		if (_owner == myself)
+			return EDEADLK;
 
-		_apply_for_mutex(myself, 0);
+		_acquire(myself, 0);
 
 		return 0;
 	}
@@ -446,19 +555,18 @@ struct Libc::Pthread_mutex_errorcheck : pthread_mutex
 	{
 		pthread_t const myself = pthread_self();
 
-		Mutex::Guard guard(_data_mutex);
+		if (_owner == myself)
+			return EDEADLK;
 
-		return _try_lock(myself);
+		return _try_acquire(myself) ? 0 : EBUSY;
 	}
 
 	int unlock() override final
 	{
-		Mutex::Guard guard(_data_mutex);
-
 		if (_owner != pthread_self())
 			return EPERM;
 
-		_next_applicant_to_owner();
+		_release();
 
 		return 0;
 	}
@@ -469,31 +577,16 @@ struct Libc::Pthread_mutex_recursive : pthread_mutex
 {
 	unsigned _nesting_level { 0 };
 
-	/* unsynchronized try */
-	int _try_lock(pthread_t thread)
-	{
-		if (!_owner) {
-			_owner = thread;
-			return 0;
-		} else if (_owner == thread) {
-			++_nesting_level;
-			return 0;
-		}
-
-		return EBUSY;
-	}
-
 	int lock() override final
 	{
 		pthread_t const myself = pthread_self();
 
-		Mutex::Guard guard(_data_mutex);
-
-		/* fast path without lock contention */
-		if (_try_lock(myself) == 0)
+		if (_owner == myself) {
+			++_nesting_level;
 			return 0;
+		}
 
-		_apply_for_mutex(myself, 0);
+		_acquire(myself, 0);
 
 		return 0;
 	}
@@ -507,20 +600,21 @@ struct Libc::Pthread_mutex_recursive : pthread_mutex
 	{
 		pthread_t const myself = pthread_self();
 
-		Mutex::Guard guard(_data_mutex);
+		if (_owner == myself) {
+			++_nesting_level;
+			return 0;
+		}
 
-		return _try_lock(myself);
+		return _try_acquire(myself) ? 0 : EBUSY;
 	}
 
 	int unlock() override final
 	{
-		Mutex::Guard guard(_data_mutex);
-
 		if (_owner != pthread_self())
 			return EPERM;
 
 		if (_nesting_level == 0)
-			_next_applicant_to_owner();
+			_release();
 		else
 			--_nesting_level;
 
@@ -529,15 +623,6 @@ struct Libc::Pthread_mutex_recursive : pthread_mutex
 };
 
 
-/*
- * The pthread_cond implementation uses the POSIX semaphore API
- * internally that does not have means to set the clock. For this
- * reason the private 'sem_set_clock' function is introduced,
- * see 'semaphore.cc' for the implementation.
-*/
-extern "C" int sem_set_clock(sem_t *sem, clockid_t clock_id);
-
-
 /* TLS */
 
 class Key_allocator : public Genode::Bit_allocator<PTHREAD_KEYS_MAX>
@@ -1081,40 +1166,123 @@ extern "C" {
 
 
 	/*
-	 * Implementation based on
-	 * http://web.archive.org/web/20010914175514/http://www-classic.be.com/aboutbe/benewsletter/volume_III/Issue40.html#Workshop
+	 * Waiters are kept in a FIFO list. Signalling does not wake up a waiter
+	 * but transfers it to the applicants of its mutex (wait morphing). So,
+	 * 'pthread_cond_broadcast' does not let all waiters run just for
+	 * contending on the mutex. Each waiter resumes once the mutex is handed
+	 * over to it.
 	 */
 
-	struct pthread_cond
+	struct pthread_cond : Genode::Noncopyable
 	{
-		int             num_waiters;
-		int             num_signallers;
-		pthread_mutex_t counter_mutex;
-		sem_t           signal_sem;
-		sem_t           handshake_sem;
+		struct Waiter : Genode::Noncopyable
+		{
+			Waiter *next { nullptr };
+
+			pthread_mutex            &mutex;
+			pthread_mutex::Applicant  applicant;
+
+			bool requeued { false };
+
+			Waiter(pthread_mutex &mutex, pthread_t thread, Libc::Blockade &blockade)
+			: mutex(mutex), applicant(thread, blockade) { }
+		};
+
+		clockid_t const clock_id;
+
+		Mutex   _data_mutex { };
+		Waiter *_waiters    { nullptr };
 
 		struct Invalid_timedwait_clock { };
 
-		void _cleanup()
+		/* _data_mutex must be hold when calling the following methods */
+
+		void _append_waiter(Waiter *waiter)
+		{
+			Waiter **tail = &_waiters;
+
+			for (; *tail; tail = &(*tail)->next) ;
+
+			*tail = waiter;
+		}
+
+		void _remove_waiter(Waiter *waiter)
 		{
-			sem_destroy(&handshake_sem);
-			sem_destroy(&signal_sem);
-			pthread_mutex_destroy(&counter_mutex);
+			Waiter **w = &_waiters;
+
+			for (; *w && *w != waiter; w = &(*w)->next) ;
+
+			*w = waiter->next;
 		}
 
-		pthread_cond(clockid_t clock_id) : num_waiters(0), num_signallers(0)
+		void _requeue(Waiter &waiter)
 		{
-			pthread_mutex_init(&counter_mutex, nullptr);
-			sem_init(&signal_sem, 0, 0);
-			sem_init(&handshake_sem, 0, 0);
+			_remove_waiter(&waiter);
+			waiter.requeued = true;
+			waiter.mutex.requeue(waiter.applicant);
+		}
 
-			if (sem_set_clock(&signal_sem, clock_id)) {
-				_cleanup();
+		pthread_cond(clockid_t clock_id) : clock_id(clock_id)
+		{
+			if (clock_id != CLOCK_REALTIME && clock_id != CLOCK_MONOTONIC)
 				throw Invalid_timedwait_clock();
-			}
 		}
 
-		~pthread_cond() { _cleanup(); }
+		/**
+		 * Wait for signal with 'mutex' held by the caller
+		 *
+		 * The mutex is held again on return.
+		 */
+		int wait(pthread_mutex &mutex, Libc::uint64_t timeout_ms)
+		{
+			return with_blockade(timeout_ms, [&] (Libc::Blockade &blockade) {
+
+				Waiter waiter { mutex, pthread_self(), blockade };
+
+				{
+					Mutex::Guard guard(_data_mutex);
+					_append_waiter(&waiter);
+				}
+
+				mutex.unlock();
+
+				blockade.block();
+
+				bool timed_out = false;
+				{
+					Mutex::Guard guard(_data_mutex);
+					if (!waiter.requeued) {
+						_remove_waiter(&waiter);
+						timed_out = true;
+					}
+				}
+
+				/*
+				 * A requeued waiter owns the mutex unless its timeout
+				 * expired before the mutex was handed over.
+				 */
+				if (timed_out || !mutex.withdraw(waiter.applicant))
+					mutex.lock();
+
+				return timed_out ? ETIMEDOUT : 0;
+			});
+		}
+
+		void signal()
+		{
+			Mutex::Guard guard(_data_mutex);
+
+			if (Waiter *waiter = _waiters)
+				_requeue(*waiter);
+		}
+
+		void broadcast()
+		{
+			Mutex::Guard guard(_data_mutex);
+
+			while (Waiter *waiter = _waiters)
+				_requeue(*waiter);
+		}
 	};
 
 
@@ -1225,53 +1393,29 @@ extern "C" {
 	                           pthread_mutex_t *__restrict mutex,
 	                           const struct timespec *__restrict abstime)
 	{
-		int result = 0;
-
-		if (!cond)
+		if (!cond || !mutex)
 			return EINVAL;
 
 		if (*cond == PTHREAD_COND_INITIALIZER)
 			cond_init(cond, NULL);
 
-		pthread_cond *c = *cond;
+		if (*mutex == PTHREAD_MUTEX_INITIALIZER)
+			mutex_init(mutex, nullptr);
 
-		pthread_mutex_lock(&c->counter_mutex);
-		c->num_waiters++;
-		pthread_mutex_unlock(&c->counter_mutex);
+		pthread_cond *c = *cond;
 
-		pthread_mutex_unlock(mutex);
+		Libc::uint64_t timeout_ms = 0;
 
-		if (!abstime) {
-			if (sem_wait(&c->signal_sem) == -1)
-				result = errno;
-		} else {
-			if (sem_timedwait(&c->signal_sem, abstime) == -1)
-				result = errno;
-		}
+		if (abstime) {
+			timespec abs_now;
+			clock_gettime(c->clock_id, &abs_now);
 
-		pthread_mutex_lock(&c->counter_mutex);
-		if (c->num_signallers > 0) {
-			if (result == ETIMEDOUT) {
-				/*
-				 * Another thread may have called pthread_cond_signal(),
-				 * detected this waiter and posted 'signal_sem' concurrently.
-				 *
-				 * We can't consume this post by 'sem_wait(&c->signal_sem)'
-				 * because a third thread may have consumed the post already
-				 * above in sem_wait/timedwait(). So, we just do nothing here
-				 * and accept the spurious wakeup on next
-				 * pthread_cond_wait/timedwait().
-				 */
-			}
-			sem_post(&c->handshake_sem);
-			--c->num_signallers;
+			timeout_ms = calculate_relative_timeout_ms(abs_now, *abstime);
+			if (!timeout_ms)
+				return ETIMEDOUT;
 		}
-		c->num_waiters--;
-		pthread_mutex_unlock(&c->counter_mutex);
-
-		pthread_mutex_lock(mutex);
 
-		return result;
+		return c->wait(**mutex, timeout_ms);
 	}
 
 	typeof(pthread_cond_timedwait) _pthread_cond_timedwait
@@ -1296,16 +1440,7 @@ extern "C" {
 		if (*cond == PTHREAD_COND_INITIALIZER)
 			cond_init(cond, NULL);
 
-		pthread_cond *c = *cond;
-
-		pthread_mutex_lock(&c->counter_mutex);
-		if (c->num_waiters > c->num_signallers) {
-			++c->num_signallers;
-			sem_post(&c->signal_sem);
-			pthread_mutex_unlock(&c->counter_mutex);
-			sem_wait(&c->handshake_sem);
-		} else
-			pthread_mutex_unlock(&c->counter_mutex);
+		(*cond)->signal();
 
 		return 0;
 	}
@@ -1322,19 +1457,7 @@ extern "C" {
 		if (*cond == PTHREAD_COND_INITIALIZER)
 			cond_init(cond, NULL);
 
-		pthread_cond *c = *cond;
-
-		pthread_mutex_lock(&c->counter_mutex);
-		if (c->num_waiters > c->num_signallers) {
-			int still_waiting = c->num_waiters - c->num_signallers;
-			c->num_signallers = c->num_waiters;
-			for (int i = 0; i < still_waiting; i++)
-				sem_post(&c->signal_sem);
-			pthread_mutex_unlock(&c->counter_mutex);
-			for (int i = 0; i < still_waiting; i++)
-				sem_wait(&c->handshake_sem);
-		} else
-			pthread_mutex_unlock(&c->counter_mutex);
+		(*cond)->broadcast();
 
 		return 0;
 	}
@@ -208,31 +208,11 @@ struct sem : Genode::Noncopyable
 
 			return 0;
 		}
-
-		int set_clock(clockid_t clock_id)
-		{
-			switch (clock_id) {
-			case CLOCK_REALTIME:
-				_clock_id = CLOCK_REALTIME;
-				return 0;
-			case CLOCK_MONOTONIC:
-				_clock_id = CLOCK_MONOTONIC;
-				return 0;
-			default:
-				break;
-			}
-			return -1;
-		}
 };
 
 
 extern "C" {
 
-	int sem_set_clock(sem_t *sem, clockid_t clock_id)
-	{
-		return (*sem)->set_clock(clock_id);
-	}
-
 	int sem_close(sem_t *)
 	{
 		warning(__func__, " not implemented");
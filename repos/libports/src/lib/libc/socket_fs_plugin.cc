@@ -17,7 +17,9 @@
 /* Genode includes */
 #include <base/env.h>
 #include <base/log.h>
+#include <base/mutex.h>
 #include <vfs/types.h>
+#include <vfs/ip_datagram.h>
 #include <util/string.h>
 #include <libc/allocator.h>
 
@@ -27,6 +29,7 @@
 #include <arpa/inet.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 #include <ctype.h>
 #include <netinet/tcp.h>
@@ -153,7 +156,8 @@ struct Libc::Socket_fs::Context : Plugin_context
 		Absolute_path const _path {
 			_read_socket_path().base(), _config_ptr->socket.string() };
 
-		enum Fd { DATA, PEEK, CONNECT, BIND, LISTEN, ACCEPT, LOCAL, REMOTE, MAX };
+		enum Fd { DATA, PEEK, CONNECT, BIND, LISTEN, ACCEPT, LOCAL, REMOTE,
+		          DATAGRAMS, DATAGRAM_SLOT, MAX };
 
 		struct
 		{
@@ -164,9 +168,55 @@ struct Libc::Socket_fs::Context : Plugin_context
 			{ "data",    -1, nullptr }, { "peek",   -1, nullptr },
 			{ "connect", -1, nullptr }, { "bind",   -1, nullptr },
 			{ "listen",  -1, nullptr }, { "accept", -1, nullptr },
-			{ "local",   -1, nullptr }, { "remote", -1, nullptr }
+			{ "local",   -1, nullptr }, { "remote", -1, nullptr },
+			{ "datagrams", -1, nullptr }, { "datagram_slot", -1, nullptr }
 		};
 
+		/* the datagrams file is opened on first use, if present */
+		bool _datagrams_probed { false };
+
+		/* payload limit per record last written to the 'datagram_slot' file */
+		size_t _datagram_slot { 0 };
+
+		/*
+		 * Buffer for batched datagram I/O
+		 *
+		 * The buffer is allocated on first use and kept for subsequent
+		 * batches. Batches can exceed the threshold above which the
+		 * allocator backs each allocation by a dedicated dataspace, which
+		 * would otherwise be allocated and freed per call.
+		 */
+		struct Batch_buffer : Noncopyable
+		{
+			Mutex  _mutex { };
+			char  *_ptr   = nullptr;
+			size_t _size  = 0;
+
+			Batch_buffer() { }
+
+			~Batch_buffer()
+			{
+				if (_ptr)
+					Libc::Allocator().free(_ptr, _size);
+			}
+
+			ssize_t with_buffer(size_t size, auto const &fn)
+			{
+				Mutex::Guard guard(_mutex);
+
+				if (_size < size) {
+					Libc::Allocator alloc { };
+					if (_ptr)
+						alloc.free(_ptr, _size);
+
+					_ptr  = (char *)alloc.alloc(size);
+					_size = size;
+				}
+				return fn(_ptr);
+			}
+		};
+
+		Batch_buffer _recv_batch { }, _send_batch { };
 
 		Proto const _proto;
 
@@ -238,7 +288,8 @@ struct Libc::Socket_fs::Context : Plugin_context
 		~Context()
 		{
 			for (unsigned i = 0; i < Fd::MAX; ++i) {
-				::close(_fd[i].num);
+				if (_fd[i].num != -1)
+					::close(_fd[i].num);
 				_fd[i].num = -1;
 				_fd[i].file = nullptr;
 			}
@@ -265,6 +316,63 @@ struct Libc::Socket_fs::Context : Plugin_context
 		int local_fd()   { return _fd[Fd::LOCAL].num; }
 		int remote_fd()  { return _fd[Fd::REMOTE].num; }
 
+		/**
+		 * Return file for batched datagram I/O, or -1 if not supported
+		 */
+		int datagrams_fd()
+		{
+			if (_proto != UDP || _datagrams_probed)
+				return _fd[Fd::DATAGRAMS].num;
+
+			_datagrams_probed = true;
+
+			auto open_file = [&] (Fd type) {
+				Absolute_path file(_fd[type].name, _path.base());
+				int const fd = open(file.base(), O_RDWR|_fd_flags);
+				if (fd != -1) {
+					_fd[type].num  = fd;
+					_fd[type].file = file_descriptor_allocator()->find_by_libc_fd(fd);
+				}
+				return fd;
+			};
+
+			/* both files are needed for batched I/O */
+			if (open_file(Fd::DATAGRAMS) != -1 && open_file(Fd::DATAGRAM_SLOT) == -1) {
+				::close(_fd[Fd::DATAGRAMS].num);
+				_fd[Fd::DATAGRAMS] = { _fd[Fd::DATAGRAMS].name, -1, nullptr };
+			}
+			return _fd[Fd::DATAGRAMS].num;
+		}
+
+		/**
+		 * Set the payload limit per record of reads from the datagrams file
+		 */
+		bool datagram_slot(size_t slot)
+		{
+			if (slot == _datagram_slot)
+				return true;
+
+			char buf[MAX_CONTROL_PATH_LEN];
+			int const len = ::snprintf(buf, sizeof(buf), "%zu", slot);
+			if (write(_fd[Fd::DATAGRAM_SLOT].num, buf, len) != len)
+				return false;
+
+			_datagram_slot = slot;
+			return true;
+		}
+
+		/**
+		 * Call 'fn' with a buffer of at least 'size' bytes for 'recvmmsg'
+		 */
+		ssize_t with_recv_batch_buffer(size_t size, auto const &fn) {
+			return _recv_batch.with_buffer(size, fn); }
+
+		/**
+		 * Call 'fn' with a buffer of at least 'size' bytes for 'sendmmsg'
+		 */
+		ssize_t with_send_batch_buffer(size_t size, auto const &fn) {
+			return _send_batch.with_buffer(size, fn); }
+
 		/* request the appropriate fd to ensure the file is open */
 		bool connect_read_ready() { return _fd_read_ready(Fd::CONNECT); }
 		bool data_read_ready()    { return _fd_read_ready(Fd::DATA); }
@@ -1060,6 +1168,266 @@ extern "C" ssize_t socket_fs_send(int libc_fd, void const *buf, ::size_t len, in
 }
 
 
+/*
+ * Batched datagram I/O
+ *
+ * 'recvmmsg' and 'sendmmsg' transfer many datagrams with a single access
+ * to the 'datagrams' file of the socket instead of accessing the 'data'
+ * and 'remote' files per datagram. If the IP stack does not provide the
+ * file, the messages are transferred one by one.
+ */
+
+namespace Libc { namespace Socket_fs {
+
+	using Datagram = Vfs::Ip_datagram;
+
+	/**
+	 * Return true if the socket becomes ready for 'events' within 'wait_ms'
+	 */
+	static bool ready_within(int libc_fd, short events, int wait_ms)
+	{
+		pollfd pfd { libc_fd, events, 0 };
+		return ::poll(&pfd, 1, wait_ms) > 0;
+	}
+
+	/* upper bound of the buffer used for one batch */
+	enum { MAX_BATCH_SIZE = 256*1024 };
+
+	static size_t iov_size(msghdr const &msg)
+	{
+		size_t size = 0;
+		for (int i = 0; i < msg.msg_iovlen; i++)
+			size += msg.msg_iov[i].iov_len;
+		return size;
+	}
+
+	static sockaddr_in sockaddr_in_struct(Datagram const &record)
+	{
+		sockaddr_in addr { };
+		addr.sin_len         = sizeof(addr);
+		addr.sin_family      = AF_INET;
+		addr.sin_port        = record.port;
+		addr.sin_addr.s_addr = record.addr;
+		return addr;
+	}
+} }
+
+
+extern "C" ssize_t socket_fs_recvmmsg(int libc_fd, mmsghdr *msgvec, ::size_t vlen,
+                                      int flags, timespec const *timeout)
+{
+	File_descriptor *fd = file_descriptor_allocator()->find_by_libc_fd(libc_fd);
+	if (!fd) return Errno(EBADF);
+
+	Socket_fs::Context *context = dynamic_cast<Socket_fs::Context *>(fd->context);
+	if (!context) return Errno(ENOTSOCK);
+	if (!msgvec)  return Errno(EFAULT);
+	if (!vlen)    return 0;
+
+	/*
+	 * Wait for the first datagram no longer than requested. Further
+	 * datagrams are received only if already available.
+	 */
+	int wait_ms = (flags & MSG_DONTWAIT) ? 0 : -1;
+	if (timeout && wait_ms) {
+		if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 || timeout->tv_nsec >= 1000*1000*1000)
+			return Errno(EINVAL);
+
+		uint64_t const ms = uint64_t(timeout->tv_sec)*1000 + timeout->tv_nsec/(1000*1000);
+		wait_ms = int(min(ms, uint64_t(0x7fffffff)));
+	}
+
+	if (wait_ms >= 0 && !Socket_fs::ready_within(libc_fd, POLLIN, wait_ms))
+		return Errno(EAGAIN);
+
+	int const datagrams_fd = (flags & MSG_PEEK) ? -1 : context->datagrams_fd();
+
+	if (datagrams_fd == -1) {
+
+		size_t n = 0;
+		for (; n < vlen; n++) {
+
+			/* do not block for messages beyond the first one */
+			if (n && !context->data_read_ready())
+				break;
+
+			ssize_t const res = socket_fs_recvmsg(libc_fd, &msgvec[n].msg_hdr, flags);
+			if (res < 0)
+				return n ? ssize_t(n) : res;
+
+			msgvec[n].msg_len = res;
+		}
+		return n;
+	}
+
+	/* reserve a slot of the size of the largest message buffer per datagram */
+	size_t slot = 0;
+	for (size_t i = 0; i < vlen; i++)
+		slot = max(slot, Socket_fs::iov_size(msgvec[i].msg_hdr));
+	slot = min(max(slot, size_t(1)), Socket_fs::Datagram::MAX_PAYLOAD);
+
+	size_t const record_size = Socket_fs::Datagram::record_size(slot);
+	size_t const batch       = min(vlen, max(size_t(1), Socket_fs::MAX_BATCH_SIZE/record_size));
+	size_t const buf_size    = batch*record_size;
+
+	return context->with_recv_batch_buffer(buf_size, [&] (char *buf) -> ssize_t {
+
+		if (!context->datagram_slot(slot) || lseek(datagrams_fd, 0, SEEK_SET) != 0)
+			return Errno(EINVAL);
+
+		ssize_t const bytes = read(datagrams_fd, buf, buf_size);
+		if (bytes <= 0)
+			return bytes ? bytes : Errno(EAGAIN);
+
+		size_t n = 0;
+		for (size_t offset = 0; n < batch && offset + sizeof(Socket_fs::Datagram) <= size_t(bytes); n++) {
+
+			Socket_fs::Datagram const &record =
+				*(Socket_fs::Datagram const *)(buf + offset);
+
+			msghdr &msg = msgvec[n].msg_hdr;
+
+			/* scatter payload into the message's I/O vectors */
+			char const *payload = record.payload();
+			size_t      remain  = record.length;
+			for (int i = 0; i < msg.msg_iovlen && remain; i++) {
+				size_t const len = min(remain, size_t(msg.msg_iov[i].iov_len));
+				::memcpy(msg.msg_iov[i].iov_base, payload, len);
+				payload += len;
+				remain  -= len;
+			}
+
+			msg.msg_flags = remain ? MSG_TRUNC : 0;
+			msgvec[n].msg_len = record.length - remain;
+
+			if (msg.msg_name) {
+				sockaddr_in const addr = Socket_fs::sockaddr_in_struct(record);
+
+				msg.msg_namelen = min(msg.msg_namelen, socklen_t(sizeof(addr)));
+				::memcpy(msg.msg_name, &addr, msg.msg_namelen);
+			}
+
+			/* control data is not supported */
+			msg.msg_controllen = 0;
+
+			offset += Socket_fs::Datagram::record_size(record.length);
+		}
+		return n;
+	});
+}
+
+
+extern "C" ssize_t socket_fs_sendmmsg(int libc_fd, mmsghdr *msgvec, ::size_t vlen, int flags)
+{
+	File_descriptor *fd = file_descriptor_allocator()->find_by_libc_fd(libc_fd);
+	if (!fd) return Errno(EBADF);
+
+	Socket_fs::Context *context = dynamic_cast<Socket_fs::Context *>(fd->context);
+	if (!context) return Errno(ENOTSOCK);
+	if (!msgvec)  return Errno(EFAULT);
+	if (!vlen)    return 0;
+
+	if ((flags & MSG_DONTWAIT) && !Socket_fs::ready_within(libc_fd, POLLOUT, 0))
+		return Errno(EAGAIN);
+
+	int const datagrams_fd = context->datagrams_fd();
+
+	/* determine the number of messages that fit into one batch */
+	size_t buf_size = 0;
+	size_t batch    = 0;
+	for (; batch < vlen; batch++) {
+
+		size_t const size = Socket_fs::iov_size(msgvec[batch].msg_hdr);
+		if (size > Socket_fs::Datagram::MAX_PAYLOAD)
+			return batch ? ssize_t(batch) : Errno(EMSGSIZE);
+
+		size_t const record_size = Socket_fs::Datagram::record_size(size);
+		if (batch && buf_size + record_size > Socket_fs::MAX_BATCH_SIZE)
+			break;
+
+		buf_size += record_size;
+	}
+
+	return context->with_send_batch_buffer(buf_size, [&] (char *buf) -> ssize_t {
+
+		/* gather all messages into one buffer */
+		size_t offset = 0;
+		for (size_t n = 0; n < batch; n++) {
+
+			msghdr const &msg = msgvec[n].msg_hdr;
+
+			Socket_fs::Datagram &record = *(Socket_fs::Datagram *)(buf + offset);
+
+			record.addr   = 0;
+			record.port   = 0;
+			record.length = uint16_t(Socket_fs::iov_size(msg));
+
+			if (msg.msg_name) {
+				if (msg.msg_namelen < sizeof(sockaddr_in))
+					return n ? ssize_t(n) : Errno(EINVAL);
+
+				sockaddr_in const &addr = *(sockaddr_in const *)msg.msg_name;
+				record.addr = addr.sin_addr.s_addr;
+				record.port = addr.sin_port;
+			}
+
+			char *payload = record.payload();
+			for (int i = 0; i < msg.msg_iovlen; i++) {
+				::memcpy(payload, msg.msg_iov[i].iov_base, msg.msg_iov[i].iov_len);
+				payload += msg.msg_iov[i].iov_len;
+			}
+
+			offset += Socket_fs::Datagram::record_size(record.length);
+		}
+
+		/* without a datagrams file, send the messages one by one */
+		if (datagrams_fd == -1) {
+
+			size_t n = 0;
+			for (size_t pos = 0; n < batch; n++) {
+
+				Socket_fs::Datagram const &record =
+					*(Socket_fs::Datagram const *)(buf + pos);
+
+				sockaddr_in const addr = Socket_fs::sockaddr_in_struct(record);
+
+				bool const named = record.addr || record.port;
+
+				ssize_t const res =
+					do_sendto(fd, record.payload(), record.length, flags,
+					          named ? (sockaddr const *)&addr : nullptr,
+					          named ? sizeof(addr) : 0);
+				if (res < 0)
+					return n ? ssize_t(n) : res;
+
+				msgvec[n].msg_len = res;
+				pos += Socket_fs::Datagram::record_size(record.length);
+			}
+			return n;
+		}
+
+		if (lseek(datagrams_fd, 0, SEEK_SET) != 0)
+			return Errno(EINVAL);
+
+		ssize_t const bytes = write(datagrams_fd, buf, offset);
+		if (bytes <= 0)
+			return bytes ? bytes : Errno(ENETDOWN);
+
+		/* count the records consumed by the IP stack */
+		size_t n = 0;
+		for (size_t pos = 0; n < batch && pos < size_t(bytes); n++) {
+
+			Socket_fs::Datagram const &record =
+				*(Socket_fs::Datagram const *)(buf + pos);
+
+			msgvec[n].msg_len = record.length;
+			pos += Socket_fs::Datagram::record_size(record.length);
+		}
+		return n;
+	});
+}
+
+
 extern "C" int socket_fs_getsockopt(int libc_fd, int level, int optname,
                                     void *optval, socklen_t *optlen)
 {
@@ -25,6 +25,7 @@ extern "C" {
 }
 
 /* libc-internal includes */
+#include <internal/epoll.h>
 #include <internal/file.h>
 #include <internal/socket_fs_plugin.h>
 #include <internal/errno.h>
@@ -88,7 +89,7 @@ int _getsockname(int libc_fd, sockaddr *addr, socklen_t *addrlen);
 __SYS_(int, accept, (int libc_fd, sockaddr *addr, socklen_t *addrlen),
 {
 	if (_config_ptr->socket.length() > 1)
-		return socket_fs_accept(libc_fd, addr, addrlen);
+		return epoll_rearm_on_eagain(libc_fd, socket_fs_accept(libc_fd, addr, addrlen));
 
 	File_descriptor *ret_fd;
 	FD_FUNC_WRAPPER_GENERIC(ret_fd =, 0, accept, libc_fd, addr, addrlen);
@@ -137,7 +138,8 @@ __SYS_(ssize_t, recvfrom, (int libc_fd, void *buf, ::size_t len, int flags,
                            sockaddr *src_addr, socklen_t *src_addrlen),
 {
 	if (_config_ptr->socket.length() > 1)
-		return socket_fs_recvfrom(libc_fd, buf, len, flags, src_addr, src_addrlen);
+		return epoll_rearm_on_eagain(libc_fd,
+		                             socket_fs_recvfrom(libc_fd, buf, len, flags, src_addr, src_addrlen));
 
 	FD_FUNC_WRAPPER(recvfrom, libc_fd, buf, len, flags, src_addr, src_addrlen);
 })
@@ -146,7 +148,7 @@ __SYS_(ssize_t, recvfrom, (int libc_fd, void *buf, ::size_t len, int flags,
 __SYS_(ssize_t, recv, (int libc_fd, void *buf, ::size_t len, int flags),
 {
 	if (_config_ptr->socket.length() > 1)
-		return socket_fs_recv(libc_fd, buf, len, flags);
+		return epoll_rearm_on_eagain(libc_fd, socket_fs_recv(libc_fd, buf, len, flags));
 
 	FD_FUNC_WRAPPER(recv, libc_fd, buf, len, flags);
 })
@@ -155,17 +157,41 @@ __SYS_(ssize_t, recv, (int libc_fd, void *buf, ::size_t len, int flags),
 __SYS_(ssize_t, recvmsg, (int libc_fd, msghdr *msg, int flags),
 {
 	if (_config_ptr->socket.length() > 1)
-		return socket_fs_recvmsg(libc_fd, msg, flags);
+		return epoll_rearm_on_eagain(libc_fd, socket_fs_recvmsg(libc_fd, msg, flags));
 
 	FD_FUNC_WRAPPER(recvmsg, libc_fd, msg, flags);
 })
 
 
+/*
+ * Batched datagram I/O is supported for the socket file system only
+ */
+extern "C" ssize_t recvmmsg(int libc_fd, mmsghdr *msgvec, ::size_t vlen, int flags,
+                            timespec const *timeout)
+{
+	if (_config_ptr->socket.length() > 1)
+		return epoll_rearm_on_eagain(libc_fd,
+		                             socket_fs_recvmmsg(libc_fd, msgvec, vlen, flags, timeout));
+
+	return Libc::Errno(ENOSYS);
+}
+
+
+extern "C" ssize_t sendmmsg(int libc_fd, mmsghdr *msgvec, ::size_t vlen, int flags)
+{
+	if (_config_ptr->socket.length() > 1)
+		return epoll_rearm_on_eagain(libc_fd, socket_fs_sendmmsg(libc_fd, msgvec, vlen, flags));
+
+	return Libc::Errno(ENOSYS);
+}
+
+
 __SYS_(ssize_t, sendto, (int libc_fd, void const *buf, ::size_t len, int flags,
                           sockaddr const *dest_addr, socklen_t dest_addrlen),
 {
 	if (_config_ptr->socket.length() > 1)
-		return socket_fs_sendto(libc_fd, buf, len, flags, dest_addr, dest_addrlen);
+		return epoll_rearm_on_eagain(libc_fd,
+		                             socket_fs_sendto(libc_fd, buf, len, flags, dest_addr, dest_addrlen));
 
 	FD_FUNC_WRAPPER(sendto, libc_fd, buf, len, flags, dest_addr, dest_addrlen);
 })
@@ -174,7 +200,7 @@ __SYS_(ssize_t, sendto, (int libc_fd, void const *buf, ::size_t len, int flags,
 extern "C" ssize_t send(int libc_fd, void const *buf, ::size_t len, int flags)
 {
 	if (_config_ptr->socket.length() > 1)
-		return socket_fs_send(libc_fd, buf, len, flags);
+		return epoll_rearm_on_eagain(libc_fd, socket_fs_send(libc_fd, buf, len, flags));
 
 	FD_FUNC_WRAPPER(send, libc_fd, buf, len, flags);
 }
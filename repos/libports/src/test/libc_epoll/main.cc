@@ -0,0 +1,333 @@
+/*
+ * \brief  Test and benchmark of epoll compared to poll
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * A population of idle pipes is registered along with a few active pipes.
+ * Each round writes one byte to every active pipe and waits until all of
+ * them were reported readable.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* libc includes */
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+
+static unsigned long long now_us()
+{
+	struct timespec ts { };
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000ULL + ts.tv_nsec/1000;
+}
+
+
+static void die(char const *msg)
+{
+	fprintf(stderr, "%s (errno=%d)\n", msg, errno);
+	exit(1);
+}
+
+
+struct Pipes
+{
+	unsigned const idle, active, count;
+
+	int *read_fds  = (int *)calloc(count, sizeof(int));
+	int *write_fds = (int *)calloc(count, sizeof(int));
+
+	Pipes(unsigned idle, unsigned active)
+	: idle(idle), active(active), count(idle + active)
+	{
+		for (unsigned i = 0; i < count; i++) {
+			int fds[2];
+			if (pipe(fds) != 0)
+				die("pipe failed");
+			read_fds[i] = fds[0]; write_fds[i] = fds[1];
+		}
+	}
+
+	/* active pipes are placed at the end, behind the idle ones */
+	unsigned first_active() const { return idle; }
+
+	void fill()
+	{
+		for (unsigned i = first_active(); i < count; i++)
+			if (write(write_fds[i], "x", 1) != 1)
+				die("write failed");
+	}
+
+	void drain(int fd)
+	{
+		char c;
+		if (read(fd, &c, 1) != 1)
+			die("read failed");
+	}
+
+	Pipes(Pipes const &) = delete;
+	Pipes &operator = (Pipes const &) = delete;
+};
+
+
+static void measure_poll(Pipes &pipes, unsigned rounds)
+{
+	struct pollfd *pollfds =
+		(struct pollfd *)calloc(pipes.count, sizeof(struct pollfd));
+
+	unsigned long long const start_us = now_us();
+
+	for (unsigned r = 0; r < rounds; r++) {
+
+		pipes.fill();
+
+		for (unsigned pending = pipes.active; pending; ) {
+
+			/* poll(2) takes the whole set with each call */
+			for (unsigned i = 0; i < pipes.count; i++)
+				pollfds[i] = { pipes.read_fds[i], POLLIN, 0 };
+
+			int const n = poll(pollfds, pipes.count, -1);
+			if (n < 0)
+				die("poll failed");
+
+			for (unsigned i = 0; i < pipes.count; i++)
+				if (pollfds[i].revents & POLLIN) {
+					pipes.drain(pollfds[i].fd);
+					pending--;
+				}
+		}
+	}
+
+	unsigned long long const duration_us = now_us() - start_us;
+
+	printf("poll:  %u rounds in %llu us, %llu us per round\n",
+	       rounds, duration_us, duration_us/rounds);
+
+	free(pollfds);
+}
+
+
+static void measure_epoll(Pipes &pipes, unsigned rounds)
+{
+	int const epfd = epoll_create1(EPOLL_CLOEXEC);
+	if (epfd < 0)
+		die("epoll_create1 failed");
+
+	for (unsigned i = 0; i < pipes.count; i++) {
+		struct epoll_event ev { };
+		ev.events  = EPOLLIN;
+		ev.data.fd = pipes.read_fds[i];
+		if (epoll_ctl(epfd, EPOLL_CTL_ADD, pipes.read_fds[i], &ev) != 0)
+			die("epoll_ctl failed");
+	}
+
+	enum { MAX_EVENTS = 64 };
+	struct epoll_event events[MAX_EVENTS];
+
+	unsigned long long const start_us = now_us();
+
+	for (unsigned r = 0; r < rounds; r++) {
+
+		pipes.fill();
+
+		for (unsigned pending = pipes.active; pending; ) {
+
+			int const n = epoll_wait(epfd, events, MAX_EVENTS, -1);
+			if (n < 0)
+				die("epoll_wait failed");
+
+			for (int i = 0; i < n; i++) {
+				pipes.drain(events[i].data.fd);
+				pending--;
+			}
+		}
+	}
+
+	unsigned long long const duration_us = now_us() - start_us;
+
+	printf("epoll: %u rounds in %llu us, %llu us per round\n",
+	       rounds, duration_us, duration_us/rounds);
+
+	close(epfd);
+}
+
+
+static void check_semantics()
+{
+	int fds[2];
+	if (pipe(fds) != 0)
+		die("pipe failed");
+
+	int const epfd = epoll_create1(0);
+
+	struct epoll_event ev { };
+	ev.events  = EPOLLIN | EPOLLET;
+	ev.data.fd = fds[0];
+
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, fds[0], &ev) != 0)
+		die("epoll_ctl ADD failed");
+
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, fds[0], &ev) == 0 || errno != EEXIST)
+		die("duplicate EPOLL_CTL_ADD not rejected");
+
+	struct epoll_event out { };
+
+	if (epoll_wait(epfd, &out, 1, 0) != 0)
+		die("empty pipe reported readable");
+
+	if (write(fds[1], "xy", 2) != 2)
+		die("write failed");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 1 || out.data.fd != fds[0])
+		die("readable pipe not reported");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 0)
+		die("edge-triggered event reported twice");
+
+	char buf[2];
+	if (read(fds[0], buf, 2) != 2)
+		die("read failed");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 0)
+		die("drained pipe reported readable");
+
+	if (write(fds[1], "z", 1) != 1)
+		die("write failed");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 1)
+		die("new edge not reported");
+
+	close(fds[0]);
+	close(fds[1]);
+
+	if (epoll_wait(epfd, &out, 1, 0) != 0)
+		die("closed file descriptor reported");
+
+	close(epfd);
+}
+
+
+/*
+ * Data arriving after the application drained a file descriptor to EAGAIN
+ * starts a new edge, even if no 'epoll_wait' observed the drained state.
+ */
+static void check_edge_after_eagain()
+{
+	int fds[2];
+	if (pipe(fds) != 0)
+		die("pipe failed");
+
+	fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+	int const epfd = epoll_create1(0);
+
+	struct epoll_event ev { };
+	ev.events  = EPOLLIN | EPOLLET;
+	ev.data.fd = fds[0];
+
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, fds[0], &ev) != 0)
+		die("epoll_ctl ADD failed");
+
+	struct epoll_event out { };
+
+	if (write(fds[1], "x", 1) != 1)
+		die("write failed");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 1)
+		die("readable pipe not reported");
+
+	char c;
+	if (read(fds[0], &c, 1) != 1)
+		die("read failed");
+
+	if (read(fds[0], &c, 1) != -1 || errno != EAGAIN)
+		die("read from drained pipe did not return EAGAIN");
+
+	if (write(fds[1], "y", 1) != 1)
+		die("write failed");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 1)
+		die("edge after EAGAIN not reported");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 0)
+		die("edge after EAGAIN reported twice");
+
+	close(fds[0]);
+	close(fds[1]);
+	close(epfd);
+}
+
+
+static void check_oneshot()
+{
+	int fds[2];
+	if (pipe(fds) != 0)
+		die("pipe failed");
+
+	int const epfd = epoll_create1(0);
+
+	struct epoll_event ev { };
+	ev.events  = EPOLLIN | EPOLLONESHOT;
+	ev.data.fd = fds[0];
+
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, fds[0], &ev) != 0)
+		die("epoll_ctl ADD failed");
+
+	if (write(fds[1], "x", 1) != 1)
+		die("write failed");
+
+	struct epoll_event out { };
+
+	if (epoll_wait(epfd, &out, 1, 0) != 1)
+		die("readable pipe not reported");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 0)
+		die("disarmed file descriptor reported");
+
+	if (epoll_ctl(epfd, EPOLL_CTL_MOD, fds[0], &ev) != 0)
+		die("epoll_ctl MOD failed");
+
+	if (epoll_wait(epfd, &out, 1, 0) != 1)
+		die("re-armed file descriptor not reported");
+
+	close(fds[0]);
+	close(fds[1]);
+	close(epfd);
+}
+
+
+int main(int argc, char **argv)
+{
+	unsigned const idle   = (argc > 1) ? atoi(argv[1]) : 1000;
+	unsigned const active = (argc > 2) ? atoi(argv[2]) : 10;
+	unsigned const rounds = (argc > 3) ? atoi(argv[3]) : 100;
+
+	check_semantics();
+	check_edge_after_eagain();
+	check_oneshot();
+
+	printf("epoll semantics check passed\n");
+
+	printf("--- %u idle pipes, %u active pipes, %u rounds ---\n",
+	       idle, active, rounds);
+
+	Pipes pipes(idle, active);
+
+	measure_poll(pipes, rounds);
+	measure_epoll(pipes, rounds);
+
+	printf("--- finished epoll benchmark ---\n");
+	return 0;
+}
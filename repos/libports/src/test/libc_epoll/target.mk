@@ -0,0 +1,5 @@
+TARGET = test-libc_epoll
+LIBS   = posix
+SRC_CC = main.cc
+
+CC_CXX_WARN_STRICT =
@@ -0,0 +1,139 @@
+/*
+ * \brief  Multi-threaded malloc benchmark
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * Each thread keeps a working set of allocations and repeatedly replaces
+ * a random entry with an allocation of random size. Sizes are drawn from
+ * a distribution dominated by small objects, as typical for C++ and
+ * scripting-language workloads.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* libc includes */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+enum { WORKING_SET = 1024, MAX_THREADS = 16 };
+
+
+static unsigned long long now_us()
+{
+	struct timespec ts { };
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000ULL + ts.tv_nsec/1000;
+}
+
+
+struct Worker
+{
+	unsigned  iterations = 0;
+	uint32_t  seed       = 1;
+	pthread_t thread { };
+
+	void *slots[WORKING_SET] { };
+
+	uint32_t _random()
+	{
+		/* xorshift32 */
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		return seed;
+	}
+
+	size_t _random_size()
+	{
+		uint32_t const r = _random();
+
+		switch (r % 16) {
+		case 15: return 4096 + r % 60000;  /* large */
+		case 14:
+		case 13: return  512 + r % 3584;   /* medium */
+		default: return    8 + r % 248;    /* small */
+		}
+	}
+
+	void run()
+	{
+		for (unsigned i = 0; i < iterations; i++) {
+			unsigned const index = _random() % WORKING_SET;
+
+			free(slots[index]);
+
+			size_t const size = _random_size();
+			slots[index] = malloc(size);
+			if (!slots[index]) {
+				fprintf(stderr, "malloc of %zu bytes failed\n", size);
+				exit(1);
+			}
+
+			/* touch the allocation */
+			memset(slots[index], 0, size < 64 ? size : 64);
+		}
+
+		for (void *&slot : slots) {
+			free(slot);
+			slot = nullptr;
+		}
+	}
+
+	static void *entry(void *arg)
+	{
+		((Worker *)arg)->run();
+		return nullptr;
+	}
+};
+
+
+static Worker workers[MAX_THREADS];
+
+
+static void measure(unsigned threads, unsigned iterations)
+{
+	for (unsigned i = 0; i < threads; i++) {
+		workers[i].iterations = iterations;
+		workers[i].seed       = 0x9e3779b9u*(i + 1);
+	}
+
+	unsigned long long const start_us = now_us();
+
+	for (unsigned i = 0; i < threads; i++)
+		if (pthread_create(&workers[i].thread, nullptr, Worker::entry, &workers[i])) {
+			fprintf(stderr, "pthread_create failed\n");
+			exit(1);
+		}
+
+	for (unsigned i = 0; i < threads; i++)
+		pthread_join(workers[i].thread, nullptr);
+
+	unsigned long long const duration_us = now_us() - start_us;
+	unsigned long long const ops         = 2ULL*threads*iterations;
+
+	printf("%2u threads: %llu malloc/free operations in %llu us, %llu ops/ms\n",
+	       threads, ops, duration_us, duration_us ? ops*1000/duration_us : 0);
+}
+
+
+int main(int argc, char **argv)
+{
+	unsigned const max_threads = (argc > 1) ? atoi(argv[1]) : 4;
+	unsigned const iterations  = (argc > 2) ? atoi(argv[2]) : 200000;
+
+	printf("--- malloc benchmark, %u iterations per thread ---\n", iterations);
+
+	for (unsigned threads = 1; threads <= max_threads && threads <= MAX_THREADS; threads *= 2)
+		measure(threads, iterations);
+
+	printf("--- finished malloc benchmark ---\n");
+	return 0;
+}
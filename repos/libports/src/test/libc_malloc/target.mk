@@ -0,0 +1,5 @@
+TARGET = test-libc_malloc
+LIBS   = posix
+SRC_CC = main.cc
+
+CC_CXX_WARN_STRICT =
@@ -0,0 +1,208 @@
+/*
+ * \brief  UDP throughput with single-datagram and batched socket calls
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * Two sockets of the same component exchange datagrams via the local IP
+ * address. Each round sends a batch of datagrams and receives them again,
+ * first with 'sendto'/'recvfrom' and then with 'sendmmsg'/'recvmmsg'.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* libc includes */
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+
+enum { MAX_BATCH = 64, MAX_SIZE = 1472 };
+
+
+static unsigned long long now_us()
+{
+	struct timespec ts { };
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000ULL + ts.tv_nsec/1000;
+}
+
+
+static void die(char const *msg)
+{
+	fprintf(stderr, "%s (errno=%d)\n", msg, errno);
+	exit(1);
+}
+
+
+static bool wait_readable(int fd)
+{
+	struct pollfd pfd { fd, POLLIN, 0 };
+	return poll(&pfd, 1, 1000) > 0;
+}
+
+
+struct Test
+{
+	unsigned const size, batch, rounds;
+
+	int const tx = socket(AF_INET, SOCK_DGRAM, 0);
+	int const rx = socket(AF_INET, SOCK_DGRAM, 0);
+
+	struct sockaddr_in rx_addr { };
+
+	char tx_buf[MAX_BATCH][MAX_SIZE];
+	char rx_buf[MAX_BATCH][MAX_SIZE];
+
+	unsigned long lost = 0;
+
+	Test(char const *ip, unsigned port, unsigned size, unsigned batch, unsigned rounds)
+	: size(size), batch(batch), rounds(rounds)
+	{
+		if (tx < 0 || rx < 0)
+			die("socket failed");
+
+		rx_addr.sin_family      = AF_INET;
+		rx_addr.sin_port        = htons(port);
+		rx_addr.sin_addr.s_addr = inet_addr(ip);
+
+		if (bind(rx, (struct sockaddr *)&rx_addr, sizeof(rx_addr)) != 0)
+			die("bind failed");
+
+		for (unsigned i = 0; i < MAX_BATCH; i++)
+			memset(tx_buf[i], 'a' + i % 26, MAX_SIZE);
+	}
+
+	void _report(char const *what, unsigned long long start_us)
+	{
+		unsigned long long const duration_us = now_us() - start_us;
+		unsigned long long const count = (unsigned long long)rounds*batch;
+
+		printf("%s: %llu datagrams of %u bytes in %llu us, %llu datagrams/s, %lu lost\n",
+		       what, count, size, duration_us,
+		       duration_us ? count*1000000ULL/duration_us : 0, lost);
+	}
+
+	void measure_single()
+	{
+		lost = 0;
+		unsigned long long const start_us = now_us();
+
+		for (unsigned r = 0; r < rounds; r++) {
+
+			for (unsigned i = 0; i < batch; i++)
+				if (sendto(tx, tx_buf[i], size, 0, (struct sockaddr *)&rx_addr,
+				           sizeof(rx_addr)) != (ssize_t)size)
+					die("sendto failed");
+
+			for (unsigned i = 0; i < batch; i++) {
+				struct sockaddr_in from { };
+				socklen_t from_len = sizeof(from);
+
+				if (!wait_readable(rx)) {
+					lost += batch - i;
+					break;
+				}
+				if (recvfrom(rx, rx_buf[i], MAX_SIZE, 0,
+				             (struct sockaddr *)&from, &from_len) < 0)
+					die("recvfrom failed");
+			}
+		}
+		_report("sendto/recvfrom  ", start_us);
+	}
+
+	void measure_batched()
+	{
+		struct iovec       tx_iov[MAX_BATCH], rx_iov[MAX_BATCH];
+		struct mmsghdr     tx_msgs[MAX_BATCH], rx_msgs[MAX_BATCH];
+		struct sockaddr_in from[MAX_BATCH];
+
+		memset(tx_msgs, 0, sizeof(tx_msgs));
+		memset(rx_msgs, 0, sizeof(rx_msgs));
+
+		for (unsigned i = 0; i < batch; i++) {
+			tx_iov[i] = { tx_buf[i], size };
+			tx_msgs[i].msg_hdr.msg_iov     = &tx_iov[i];
+			tx_msgs[i].msg_hdr.msg_iovlen  = 1;
+			tx_msgs[i].msg_hdr.msg_name    = &rx_addr;
+			tx_msgs[i].msg_hdr.msg_namelen = sizeof(rx_addr);
+
+			rx_iov[i] = { rx_buf[i], MAX_SIZE };
+			rx_msgs[i].msg_hdr.msg_iov     = &rx_iov[i];
+			rx_msgs[i].msg_hdr.msg_iovlen  = 1;
+			rx_msgs[i].msg_hdr.msg_name    = &from[i];
+		}
+
+		lost = 0;
+		unsigned long long const start_us = now_us();
+
+		for (unsigned r = 0; r < rounds; r++) {
+
+			for (unsigned sent = 0; sent < batch; ) {
+				int const n = sendmmsg(tx, &tx_msgs[sent], batch - sent, 0);
+				if (n <= 0)
+					die("sendmmsg failed");
+				sent += n;
+			}
+
+			for (unsigned received = 0; received < batch; ) {
+
+				if (!wait_readable(rx)) {
+					lost += batch - received;
+					break;
+				}
+
+				for (unsigned i = received; i < batch; i++)
+					rx_msgs[i].msg_hdr.msg_namelen = sizeof(from[i]);
+
+				int const n = recvmmsg(rx, &rx_msgs[received], batch - received, 0, nullptr);
+				if (n <= 0)
+					die("recvmmsg failed");
+
+				for (int i = 0; i < n; i++)
+					if ((size_t)rx_msgs[received + i].msg_len != size)
+						die("recvmmsg returned unexpected datagram size");
+
+				received += n;
+			}
+		}
+		_report("sendmmsg/recvmmsg", start_us);
+	}
+
+	Test(Test const &) = delete;
+	Test &operator = (Test const &) = delete;
+};
+
+
+int main(int argc, char **argv)
+{
+	char const *ip     = (argc > 1) ? argv[1] : "10.0.2.55";
+	unsigned    size   = (argc > 2) ? atoi(argv[2]) : 64;
+	unsigned    batch  = (argc > 3) ? atoi(argv[3]) : 32;
+	unsigned    rounds = (argc > 4) ? atoi(argv[4]) : 1000;
+
+	if (size  > MAX_SIZE)  size  = MAX_SIZE;
+	if (batch > MAX_BATCH) batch = MAX_BATCH;
+
+	printf("--- %s, %u-byte datagrams, batches of %u, %u rounds ---\n",
+	       ip, size, batch, rounds);
+
+	static Test test(ip, 7000, size, batch, rounds);
+
+	test.measure_single();
+	test.measure_batched();
+
+	printf("--- finished UDP batch benchmark ---\n");
+	return 0;
+}
@@ -0,0 +1,5 @@
+TARGET = test-libc_udp_batch
+LIBS   = posix
+SRC_CC = main.cc
+
+CC_CXX_WARN_STRICT =
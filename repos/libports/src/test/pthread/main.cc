@@ -1344,6 +1344,152 @@ static void test_pthread_once()
 }
 
 
+/*
+ * Contention benchmarks
+ *
+ * The benchmarks measure the throughput of short critical sections and of
+ * condition-variable broadcasts with an increasing number of threads.
+ */
+
+enum { MAX_THREADS = 4 };
+
+
+static unsigned long elapsed_us(timespec const &start)
+{
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - start.tv_sec)*1'000'000ul
+	     + (now.tv_nsec - start.tv_nsec)/1'000;
+}
+
+
+struct Bench_mutex_contention
+{
+	enum { ITERATIONS = 50'000 };
+
+	Mutex<PTHREAD_MUTEX_NORMAL> mutex { };
+
+	unsigned long counter = 0;
+
+	static void *thread_fn(void *arg)
+	{
+		Bench_mutex_contention &bench = *(Bench_mutex_contention *)arg;
+
+		for (unsigned i = 0; i < ITERATIONS; i++) {
+			pthread_mutex_lock(bench.mutex.mutex());
+			bench.counter++;
+			pthread_mutex_unlock(bench.mutex.mutex());
+		}
+		return nullptr;
+	}
+
+	Bench_mutex_contention(unsigned num_threads)
+	{
+		pthread_t threads[MAX_THREADS];
+
+		timespec start;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+		for (unsigned i = 0; i < num_threads; i++)
+			if (pthread_create(&threads[i], 0, thread_fn, this) != 0) {
+				printf("Error: pthread_create() failed\n");
+				exit(-1);
+			}
+
+		for (unsigned i = 0; i < num_threads; i++)
+			pthread_join(threads[i], nullptr);
+
+		unsigned long const duration_us = elapsed_us(start);
+
+		if (counter != num_threads*ITERATIONS) {
+			printf("Error: mutex counter is %lu, expected %u\n",
+			       counter, num_threads*ITERATIONS);
+			exit(-1);
+		}
+
+		printf("mutex contention: %u threads, %lu lock/unlock pairs in %lu us\n",
+		       num_threads, counter, duration_us);
+	}
+};
+
+
+struct Bench_cond_broadcast
+{
+	enum { ROUNDS = 500 };
+
+	Cond                        cond      { };
+	Cond                        done_cond { };
+	Mutex<PTHREAD_MUTEX_NORMAL> mutex     { };
+
+	unsigned round   = 0;
+	unsigned arrived = 0;
+
+	static void *thread_fn(void *arg)
+	{
+		Bench_cond_broadcast &bench = *(Bench_cond_broadcast *)arg;
+
+		pthread_mutex_lock(bench.mutex.mutex());
+		for (unsigned seen = 0; seen < ROUNDS; ) {
+			while (bench.round == seen)
+				pthread_cond_wait(bench.cond.cond(), bench.mutex.mutex());
+
+			seen = bench.round;
+			bench.arrived++;
+			pthread_cond_signal(bench.done_cond.cond());
+		}
+		pthread_mutex_unlock(bench.mutex.mutex());
+		return nullptr;
+	}
+
+	Bench_cond_broadcast(unsigned num_threads)
+	{
+		pthread_t threads[MAX_THREADS];
+
+		for (unsigned i = 0; i < num_threads; i++)
+			if (pthread_create(&threads[i], 0, thread_fn, this) != 0) {
+				printf("Error: pthread_create() failed\n");
+				exit(-1);
+			}
+
+		timespec start;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+		pthread_mutex_lock(mutex.mutex());
+		for (unsigned i = 1; i <= ROUNDS; i++) {
+			arrived = 0;
+			round   = i;
+			pthread_cond_broadcast(cond.cond());
+
+			while (arrived != num_threads)
+				pthread_cond_wait(done_cond.cond(), mutex.mutex());
+		}
+		pthread_mutex_unlock(mutex.mutex());
+
+		unsigned long const duration_us = elapsed_us(start);
+
+		for (unsigned i = 0; i < num_threads; i++)
+			pthread_join(threads[i], nullptr);
+
+		printf("cond broadcast: %u threads, %u rounds in %lu us\n",
+		       num_threads, (unsigned)ROUNDS, duration_us);
+	}
+};
+
+
+static void bench_contention()
+{
+	printf("main thread: contention benchmarks\n");
+
+	for (unsigned threads = 1; threads <= MAX_THREADS; threads *= 2) {
+		Bench_mutex_contention mutex_bench(threads);
+		Bench_cond_broadcast   cond_bench(threads);
+	}
+
+	printf("main thread: contention benchmarks done\n");
+}
+
+
 int main(int argc, char **argv)
 {
 	printf("--- pthread test ---\n");
@@ -1364,6 +1510,7 @@ int main(int argc, char **argv)
 	test_tls();
 	test_thread_local_destructor();
 	test_pthread_once();
+	bench_contention();
 
 	printf("--- returning from main ---\n");
 	return 0;
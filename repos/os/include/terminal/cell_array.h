@@ -45,6 +45,19 @@ class Terminal::Cell_array
 		CELL     **_array      = nullptr;
 		bool      *_line_dirty = nullptr;
 
+		/*
+		 * Scroll operation not yet applied to the pixels of the consumer
+		 */
+		struct Scroll
+		{
+			int  start = 0, end = 0;  /* scroll region */
+			int  lines = 0;           /* distance moved upwards, negative if downwards */
+			bool untracked = false;   /* operations on different regions */
+		};
+
+		bool   _track_scrolling = false;
+		Scroll _scroll { };
+
 		using Char_cell_line = CELL *;
 
 		void _clear_line(Char_cell_line line)
@@ -59,22 +72,51 @@ class Terminal::Cell_array
 				_line_dirty[line] = true;
 		}
 
-		void _scroll_vertically(int start, int end, bool up)
+		static void _rotate(auto *array, int start, int end, bool up)
 		{
-			/* rotate lines of the scroll region */
-			Char_cell_line yanked_line = _array[up ? start : end];
+			auto const yanked = array[up ? start : end];
 
 			if (up) {
 				for (int line = start; line <= end - 1; line++)
-					_array[line] = _array[line + 1];
+					array[line] = array[line + 1];
 			} else {
 				for (int line = end; line >= start + 1; line--)
-					_array[line] = _array[line - 1];
+					array[line] = array[line - 1];
+			}
+
+			array[up ? end : start] = yanked;
+		}
+
+		void _scroll_vertically(int start, int end, bool up)
+		{
+			/* rotate lines of the scroll region */
+			_rotate(_array, start, end, up);
+
+			_clear_line(_array[up ? end : start]);
+
+			bool const tracked = _track_scrolling && !_scroll.untracked
+			                  && (_scroll.lines == 0 || (_scroll.start == start &&
+			                                             _scroll.end   == end));
+			if (tracked) {
+
+				/*
+				 * The dirty state follows the content of each line. Only the
+				 * newly exposed line must be painted after moving the pixels.
+				 */
+				_rotate(_line_dirty, start, end, up);
+				_line_dirty[up ? end : start] = true;
+
+				_scroll.start  = start;
+				_scroll.end    = end;
+				_scroll.lines += up ? 1 : -1;
+				return;
 			}
 
-			_clear_line(yanked_line);
+			/* pixels of a pending scroll operation are not moved anymore */
+			if (_scroll.lines)
+				_mark_lines_as_dirty(_scroll.start, _scroll.end);
 
-			_array[up ? end: start] = yanked_line;
+			_scroll = { .start = 0, .end = 0, .lines = 0, .untracked = _track_scrolling };
 
 			_mark_lines_as_dirty(start, end);
 		}
@@ -116,6 +158,39 @@ class Terminal::Cell_array
 		{
 			for (unsigned i = 0; i < _num_lines; i++)
 				_line_dirty[i] = true;
+
+			_scroll = { };
+		}
+
+		/**
+		 * Enable tracking of scroll operations
+		 *
+		 * By default, scrolling marks all lines of the scroll region as
+		 * dirty. With tracking enabled, only the newly exposed lines are
+		 * marked as dirty. The consumer is expected to move the pixels of
+		 * the scroll region as reported by 'with_pending_scroll' before
+		 * painting the dirty lines.
+		 */
+		void track_scrolling(bool enabled)
+		{
+			_track_scrolling = enabled;
+			mark_all_lines_as_dirty();
+		}
+
+		/**
+		 * Call 'fn' with the scroll operation accumulated since the last call
+		 *
+		 * The functor is called with the first and last line of the scroll
+		 * region and the number of lines the content moved upwards, which is
+		 * negative if the content moved downwards. It is not called if no
+		 * pixels need to be moved.
+		 */
+		void with_pending_scroll(auto const &fn)
+		{
+			if (_scroll.lines)
+				fn(_scroll.start, _scroll.end, _scroll.lines);
+
+			_scroll = { };
 		}
 
 		void set_cell(int column, int line, CELL cell)
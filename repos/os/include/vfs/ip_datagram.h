@@ -0,0 +1,60 @@
+/*
+ * \brief  Record format of the 'datagrams' file of IP socket directories
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__VFS__IP_DATAGRAM_H_
+#define _INCLUDE__VFS__IP_DATAGRAM_H_
+
+#include <util/misc_math.h>
+#include <base/stdint.h>
+
+namespace Vfs { struct Ip_datagram; }
+
+
+/**
+ * Header of a datagram record, directly followed by the payload
+ *
+ * A write to the 'datagrams' file of a datagram socket sends one datagram
+ * per record. A zero address and port select the remote address of the
+ * socket. A read fills the buffer with one record per received datagram.
+ * The decimal value written to the 'datagram_slot' file of the socket
+ * directory limits the payload size per record of subsequent reads, which
+ * lets the reader reserve a fixed-size slot per datagram. The default is
+ * 'MAX_PAYLOAD'. The seek offset is ignored. A datagram larger than the
+ * limit is truncated to it. The first record of a read is additionally
+ * truncated to the remaining buffer space. Further records are received
+ * only if the remaining buffer space holds a whole slot. Otherwise, the
+ * datagram is left for the next read. Each record starts at a 4-byte
+ * boundary.
+ */
+struct Vfs::Ip_datagram
+{
+	Genode::uint32_t addr;    /* IPv4 address, network byte order */
+	Genode::uint16_t port;    /* network byte order */
+	Genode::uint16_t length;  /* payload size in bytes */
+
+	static constexpr Genode::size_t MAX_PAYLOAD = 0xffff;
+
+	/**
+	 * Return size of a record including the alignment padding
+	 */
+	static constexpr Genode::size_t record_size(Genode::size_t payload)
+	{
+		return Genode::align_addr(sizeof(Ip_datagram) + payload, 2);
+	}
+
+	char       *payload()       { return (char *)(this + 1); }
+	char const *payload() const { return (char const *)(this + 1); }
+
+} __attribute__((packed));
+
+#endif /* _INCLUDE__VFS__IP_DATAGRAM_H_ */
@@ -18,10 +18,78 @@
 #include <base/component.h>
 #include <base/attached_rom_dataspace.h>
 #include <base/heap.h>
+#include <base/id_space.h>
 #include <os/reporter.h>
+#include <util/dictionary.h>
 
 enum SORT_TIME { EC_TIME = 0, SC_TIME = 1};
 
+/**
+ * Node of the label hierarchy used to aggregate the execution times
+ *
+ * A group corresponds to a label prefix, e.g., "init -> subsystem", and
+ * accumulates the execution times of all subjects within its subtree.
+ */
+struct Subject_group : Genode::Dictionary<Subject_group, Genode::Session_label>::Element,
+                       Genode::List<Subject_group>::Element
+{
+	using Label       = Genode::Session_label;
+	using Groups      = Genode::Dictionary<Subject_group, Label>;
+	using Group_list  = Genode::List<Subject_group>;
+
+	/*
+	 * Noncopyable
+	 */
+	Subject_group(Subject_group const &);
+	Subject_group &operator = (Subject_group const &);
+
+	Subject_group * const parent;
+
+	Group_list &_siblings;
+	Group_list  children { };
+
+	/* number of subjects within the subtree */
+	unsigned users = 0;
+
+	/* accumulated values of the last period */
+	unsigned         threads        = 0;
+	Genode::uint64_t recent_time[2] = { 0, 0 };
+
+	Subject_group(Groups &groups, Label const &label,
+	              Subject_group *parent, Group_list &siblings)
+	:
+		Groups::Element(groups, label), parent(parent), _siblings(siblings)
+	{
+		_siblings.insert(this);
+	}
+
+	~Subject_group() { _siblings.remove(this); }
+
+	void reset()
+	{
+		threads = 0;
+		recent_time[EC_TIME] = recent_time[SC_TIME] = 0;
+
+		for (Subject_group *c = children.first(); c; c = c->next())
+			c->reset();
+	}
+
+	void generate(Genode::Generator &g) const
+	{
+		g.node("group", [&] {
+			g.attribute("name",    Label(name).last_element());
+			g.attribute("threads", threads);
+			g.attribute("ec_time", recent_time[EC_TIME]);
+			g.attribute("sc_time", recent_time[SC_TIME]);
+
+			for (Subject_group const *c = children.first(); c; c = c->next())
+				if (c->threads)
+					c->generate(g);
+		});
+	}
+};
+
+
 struct Trace_subject_registry
 {
 	private:
@@ -30,14 +98,25 @@ struct Trace_subject_registry
 		{
 			Genode::Trace::Subject_id const id;
 
+			Genode::Id_space<Entry>::Element const _id_elem;
+
 			Genode::Trace::Subject_info info { };
 
+			Subject_group *group = nullptr;
+
+			/*
+			 * Noncopyable
+			 */
+			Entry(Entry const &);
+			Entry &operator = (Entry const &);
+
 			/**
 			 * Execution time during the last period
 			 */
 			Genode::uint64_t recent_time[2] = { 0, 0 };
 
-			Entry(Genode::Trace::Subject_id id) : id(id) { }
+			Entry(Genode::Trace::Subject_id id, Genode::Id_space<Entry> &ids)
+			: id(id), _id_elem(*this, ids, { id.id }) { }
 
 			void update(Genode::Trace::Subject_info const &new_info)
 			{
@@ -57,15 +136,85 @@ struct Trace_subject_registry
 			}
 		};
 
-		Genode::List<Entry> _entries { };
+		Genode::List<Entry>     _entries { };
+		Genode::Id_space<Entry> _ids     { };
 
 		Entry *_lookup(Genode::Trace::Subject_id const id)
 		{
-			for (Entry *e = _entries.first(); e; e = e->next())
-				if (e->id == id)
-					return e;
+			return _ids.apply<Entry>({ id.id },
+				[&] (Entry &e) { return &e; },
+				[&] () -> Entry * { return nullptr; });
+		}
+
+		Subject_group::Groups     _groups      { };
+		Subject_group::Group_list _root_groups { };
+
+		unsigned _group_depth = 0;
+
+		/**
+		 * Return group of label at the configured depth, create if needed
+		 */
+		Subject_group *_group(Genode::Session_label const &label,
+		                      Genode::Allocator &alloc)
+		{
+			using Label = Genode::Session_label;
+
+			if (!_group_depth)
+				return nullptr;
+
+			/* collect label prefixes from the leaf to the root */
+			Label    prefixes[MAX_GROUP_DEPTH];
+			unsigned levels = 0;
+			for (Label l = label; l.length() > 1; l = l.prefix())
+				prefixes[levels++ % MAX_GROUP_DEPTH] = l;
+
+			if (levels > MAX_GROUP_DEPTH) {
+				/* keep the topmost prefixes only */
+				Label top[MAX_GROUP_DEPTH];
+				for (unsigned i = 0; i < MAX_GROUP_DEPTH; i++)
+					top[i] = prefixes[(levels + i) % MAX_GROUP_DEPTH];
+				for (unsigned i = 0; i < MAX_GROUP_DEPTH; i++)
+					prefixes[i] = top[i];
+				levels = MAX_GROUP_DEPTH;
+			}
+
+			Subject_group *parent = nullptr;
+			for (unsigned i = 0; i < Genode::min(levels, _group_depth); i++) {
+
+				Label const &prefix = prefixes[levels - 1 - i];
+
+				parent = _groups.with_element(prefix,
+					[&] (Subject_group &group) { return &group; },
+					[&] {
+						return new (alloc)
+							Subject_group(_groups, prefix, parent,
+							              parent ? parent->children : _root_groups); });
+			}
+
+			for (Subject_group *g = parent; g; g = g->parent)
+				g->users++;
+
+			return parent;
+		}
+
+		void _release_group(Subject_group *group, Genode::Allocator &alloc)
+		{
+			while (group) {
+				Subject_group * const parent = group->parent;
+
+				if (--group->users == 0)
+					Genode::destroy(alloc, group);
+
+				group = parent;
+			}
+		}
 
-			return nullptr;
+		void _destroy(Entry *e, Genode::Trace::Connection &trace, Genode::Allocator &alloc)
+		{
+			trace.free(e->id);
+			_release_group(e->group, alloc);
+			_entries.remove(e);
+			Genode::destroy(alloc, e);
 		}
 
 		enum { MAX_CPUS_X = 16, MAX_CPUS_Y = 4, MAX_ELEMENTS_PER_CPU = 6};
@@ -79,6 +228,64 @@ struct Trace_subject_registry
 
 	public:
 
+		enum { MAX_GROUP_DEPTH = 8 };
+
+		/**
+		 * Set depth of the label hierarchy used for the report
+		 */
+		void group_depth(unsigned depth, Genode::Allocator &alloc)
+		{
+			depth = Genode::min(depth, (unsigned)MAX_GROUP_DEPTH);
+			if (depth == _group_depth)
+				return;
+
+			for (Entry *e = _entries.first(); e; e = e->next()) {
+				_release_group(e->group, alloc);
+				e->group = nullptr;
+			}
+
+			_group_depth = depth;
+
+			for (Entry *e = _entries.first(); e; e = e->next())
+				e->group = _group(e->info.session_label(), alloc);
+		}
+
+		void generate_report(Genode::Generator &g, bool with_threads)
+		{
+			for (Subject_group *r = _root_groups.first(); r; r = r->next())
+				r->reset();
+
+			for (Entry const *e = _entries.first(); e; e = e->next())
+				for (Subject_group *group = e->group; group; group = group->parent) {
+					group->threads++;
+					group->recent_time[EC_TIME] += e->recent_time[EC_TIME];
+					group->recent_time[SC_TIME] += e->recent_time[SC_TIME];
+				}
+
+			for (Subject_group const *r = _root_groups.first(); r; r = r->next())
+				if (r->threads)
+					r->generate(g);
+
+			if (!with_threads)
+				return;
+
+			for (Entry const *e = _entries.first(); e; e = e->next()) {
+				if (!e->recent_time[EC_TIME] && !e->recent_time[SC_TIME])
+					continue;
+
+				g.node("thread", [&] {
+					g.attribute("label",    e->info.session_label());
+					g.attribute("name",     e->info.thread_name());
+					g.attribute("cpu",      Genode::String<12>(e->info.affinity().xpos(), ".",
+					                                           e->info.affinity().ypos()));
+					g.attribute("priority", e->info.execution_time().priority);
+					g.attribute("quantum",  e->info.execution_time().quantum);
+					g.attribute("ec_time",  e->recent_time[EC_TIME]);
+					g.attribute("sc_time",  e->recent_time[SC_TIME]);
+				});
+			}
+		}
+
 		bool update(Genode::Trace::Connection &trace,
 		            Genode::Allocator &alloc)
 		{
@@ -87,7 +294,8 @@ struct Trace_subject_registry
 			{
 				Entry *e = _lookup(id);
 				if (!e) {
-					e = new (alloc) Entry(id);
+					e = new (alloc) Entry(id, _ids);
+					e->group = _group(info.session_label(), alloc);
 					_entries.insert(e);
 				}
 
@@ -95,12 +303,8 @@ struct Trace_subject_registry
 
 				/* remove dead threads which did not run in the last period */
 				if (e->info.state() == Genode::Trace::Subject_info::DEAD &&
-				    !e->recent_time[EC_TIME] && !e->recent_time[SC_TIME]) {
-
-					trace.free(e->id);
-					_entries.remove(e);
-					Genode::destroy(alloc, e);
-				}
+				    !e->recent_time[EC_TIME] && !e->recent_time[SC_TIME])
+					_destroy(e, trace, alloc);
 			});
 
 			return res.count < res.limit;
@@ -108,11 +312,8 @@ struct Trace_subject_registry
 
 		void flush(Genode::Trace::Connection &trace, Genode::Allocator &alloc)
 		{
-			while (Entry * const e = _entries.first()) {
-					trace.free(e->id);
-					_entries.remove(e);
-					Genode::destroy(alloc, e);
-			}
+			while (Entry * const e = _entries.first())
+				_destroy(e, trace, alloc);
 		}
 
 		void top(enum SORT_TIME sorting)
@@ -316,6 +517,10 @@ struct App::Main
 
 	Trace_subject_registry _trace_subject_registry { };
 
+	Constructible<Expanding_reporter> _reporter { };
+
+	bool _report_threads = false;
+
 	void _handle_config();
 
 	Signal_handler<Main> _config_handler = {
@@ -352,6 +557,22 @@ void App::Main::_handle_config()
 	    _sort == EC_TIME ? "execution context (ec) [other option is scheduling context (sc)]"
 	                     : "scheduling context (sc) [other option is execution context (ec)]");
 
+	unsigned depth = 0;
+	_report_threads = false;
+	_config.node().with_sub_node("report",
+		[&] (Node const &report) {
+			depth           = report.attribute_value("depth", 2u);
+			_report_threads = report.attribute_value("threads", false); },
+		[&] { });
+
+	if (depth && !_reporter.constructed())
+		_reporter.construct(_env, "top", "top");
+
+	if (!depth)
+		_reporter.destruct();
+
+	_trace_subject_registry.group_depth(depth, _heap);
+
 	_timer.trigger_periodic(1000*_period_ms);
 }
 
@@ -364,6 +585,12 @@ void App::Main::_handle_period()
 	if (arg_buffer_sufficient) {
 		/* show most significant consumers */
 		_trace_subject_registry.top(_sort);
+
+		if (_reporter.constructed())
+			_reporter->generate([&] (Generator &g) {
+				g.attribute("period_ms", _period_ms);
+				_trace_subject_registry.generate_report(g, _report_threads);
+			});
 		return;
 	}
 
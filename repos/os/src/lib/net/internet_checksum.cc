@@ -115,6 +115,12 @@ void Internet_checksum_diff::add_up_diff(Packed_uint16 const *new_data_ptr,
 }
 
 
+void Internet_checksum_diff::add_up_diff(Internet_checksum_diff const &icd)
+{
+	_value += icd._value;
+}
+
+
 uint16_t Internet_checksum_diff::apply_to(signed long sum) const
 {
 	sum += _value;
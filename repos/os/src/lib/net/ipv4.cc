@@ -182,3 +182,12 @@ void Ipv4_packet::update_checksum(Internet_checksum_diff const &icd)
 {
 	_checksum = icd.apply_to(_checksum);
 }
+
+
+void Ipv4_packet::update_checksum(Internet_checksum_diff const &icd,
+                                  Internet_checksum_diff       &caused_icd)
+{
+	uint16_t const old_checksum = _checksum;
+	update_checksum(icd);
+	caused_icd.add_up_diff((Packed_uint16 *)&_checksum, (Packed_uint16 *)&old_checksum, 2);
+}
@@ -46,3 +46,32 @@ bool Net::Udp_packet::checksum_error(Ipv4_address ip_src,
 	return internet_checksum_pseudo_ip((Packed_uint16 *)this, length(), _length,
 	                                   Ipv4_packet::Protocol::UDP, ip_src, ip_dst);
 }
+
+
+void Net::Udp_packet::update_checksum(Internet_checksum_diff const &icd)
+{
+	/* a zero checksum denotes that the sender didn't calculate a checksum */
+	if (!_checksum)
+		return;
+
+	/* a calculated checksum of zero is transmitted as all ones */
+	_checksum = icd.apply_to(_checksum);
+	if (!_checksum)
+		_checksum = 0xffff;
+}
+
+
+void Net::Udp_packet::src_port(Port p, Internet_checksum_diff &icd)
+{
+	uint16_t const p_be = host_to_big_endian(p.value);
+	icd.add_up_diff((Packed_uint16 *)&p_be, (Packed_uint16 *)&_src_port, 2);
+	_src_port = p_be;
+}
+
+
+void Net::Udp_packet::dst_port(Port p, Internet_checksum_diff &icd)
+{
+	uint16_t const p_be = host_to_big_endian(p.value);
+	icd.add_up_diff((Packed_uint16 *)&p_be, (Packed_uint16 *)&_dst_port, 2);
+	_dst_port = p_be;
+}
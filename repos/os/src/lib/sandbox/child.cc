@@ -27,7 +27,8 @@ void Sandbox::Child::destroy_services()
 
 
 Sandbox::Child::Apply_config_result
-Sandbox::Child::apply_config(Node const &start_node)
+Sandbox::Child::_apply_config(Node const &start_node,
+                              With_service_name::Ft const &service_changed_fn)
 {
 	if (abandoned() || stuck() || restart_scheduled() || _exited)
 		return NO_SIDE_EFFECTS;
@@ -118,6 +119,7 @@ Sandbox::Child::apply_config(Node const &start_node)
 
 			if (!still_provided) {
 				service.abandon();
+				service_changed_fn(name);
 				provided_services_changed = true;
 			}
 		});
@@ -128,6 +130,7 @@ Sandbox::Child::apply_config(Node const &start_node)
 					return;
 
 				_add_service(node);
+				service_changed_fn(node.attribute_value("name", Service::Name()));
 				provided_services_changed = true;
 			});
 		});
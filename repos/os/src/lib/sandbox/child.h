@@ -648,13 +648,36 @@ class Sandbox::Child : Child_policy, Routed_service::Wakeup
 
 		enum Apply_config_result { PROVIDED_SERVICES_CHANGED, NO_SIDE_EFFECTS };
 
+		using With_service_name = Callable<void, Service::Name const &>;
+
+		Apply_config_result _apply_config(Node const &, With_service_name::Ft const &);
+
 		/**
 		 * Apply new configuration to child
 		 *
+		 * The 'service_changed_fn' is called with the name of each provided
+		 * service that appeared or disappeared.
+		 *
 		 * \throw Allocator::Out_of_memory  unable to allocate buffer for new
 		 *                                  config
 		 */
-		Apply_config_result apply_config(Node const &start_node);
+		Apply_config_result apply_config(Node const &start_node,
+		                                 auto const &service_changed_fn)
+		{
+			return _apply_config(start_node, With_service_name::Fn { service_changed_fn });
+		}
+
+		/**
+		 * Return true if any session of the child is directed to a service
+		 * for which 'cond_fn' returns true
+		 */
+		bool any_session_to(auto const &cond_fn) const
+		{
+			bool result = false;
+			_child.for_each_session([&] (Session_state const &session) {
+				result = result || cond_fn(session.service().name()); });
+			return result;
+		}
 
 		bool uncertain_dependencies() const { return _uncertain_dependencies; }
 
@@ -88,11 +88,56 @@ struct Genode::Sandbox::Library : ::Sandbox::State_reporter::Producer,
 	 */
 	Config_model _config_model { };
 
+	/*
+	 * Names of the services that appeared or disappeared while updating the
+	 * config model
+	 *
+	 * Only children with sessions to one of those services must re-evaluate
+	 * their routes. If more services changed than can be tracked, all
+	 * children are considered as affected.
+	 */
+	struct Changed_services
+	{
+		static constexpr unsigned MAX_NAMES = 16;
+
+		Service::Name _names[MAX_NAMES] { };
+
+		unsigned _count    = 0;
+		bool     _overflow = false;
+
+		void reset() { _count = 0; _overflow = false; }
+
+		void add(Service::Name const &name)
+		{
+			if (affects(name))
+				return;
+
+			if (_count == MAX_NAMES)
+				_overflow = true;
+			else
+				_names[_count++] = name;
+		}
+
+		bool any() const { return _count || _overflow; }
+
+		bool affects(Service::Name const &name) const
+		{
+			if (_overflow)
+				return true;
+
+			for (unsigned i = 0; i < _count; i++)
+				if (_names[i] == name)
+					return true;
+
+			return false;
+		}
+	};
+
 	/*
 	 * Variables for tracking the side effects of updating the config model
 	 */
-	bool _server_appeared_or_disappeared = false;
-	bool _state_report_outdated          = false;
+	Changed_services _changed_services      { };
+	bool             _state_report_outdated = false;
 
 	unsigned _child_cnt = 0;
 
@@ -386,8 +431,9 @@ bool Genode::Sandbox::Library::ready_to_create_child(Start_model::Name    const
 
 		_avail_cpu.percent -= min(_avail_cpu.percent, child.cpu_quota().percent);
 
-		if (start_node.has_sub_node("provides"))
-			_server_appeared_or_disappeared = true;
+		start_node.with_optional_sub_node("provides", [&] (Node const &provides) {
+			provides.for_each_sub_node("service", [&] (Node const &service) {
+				_changed_services.add(service.attribute_value("name", Service::Name())); }); });
 
 		_state_report_outdated = true;
 
@@ -420,12 +466,14 @@ void Genode::Sandbox::Library::update_child(Child &child, Node const &start)
 	if (child.abandoned())
 		return;
 
-	switch (child.apply_config(start)) {
+	auto service_changed_fn = [&] (Service::Name const &name) {
+		_changed_services.add(name); };
+
+	switch (child.apply_config(start, service_changed_fn)) {
 
 	case Child::NO_SIDE_EFFECTS: break;
 
 	case Child::PROVIDED_SERVICES_CHANGED:
-		_server_appeared_or_disappeared = true;
 		_state_report_outdated = true;
 		break;
 	};
@@ -434,8 +482,8 @@ void Genode::Sandbox::Library::update_child(Child &child, Node const &start)
 
 void Genode::Sandbox::Library::apply_config(Node const &config)
 {
-	_server_appeared_or_disappeared = false;
-	_state_report_outdated          = false;
+	_changed_services.reset();
+	_state_report_outdated = false;
 
 	_config_model.update_from_node(config,
 	                               _heap,
@@ -455,7 +503,10 @@ void Genode::Sandbox::Library::apply_config(Node const &config)
 	 * After importing the new configuration, servers may have disappeared
 	 * (STATE_ABANDONED) or become new available.
 	 *
-	 * Re-evaluate the dependencies of the existing children.
+	 * Re-evaluate the dependencies of the existing children. Only children
+	 * with sessions to services that appeared or disappeared are affected,
+	 * which spares the route resolution for all sessions of all children
+	 * when editing a large configuration.
 	 *
 	 * - Stuck children (STATE_STUCK) may become alive.
 	 * - Children with broken dependencies may have become stuck.
@@ -480,7 +531,18 @@ void Genode::Sandbox::Library::apply_config(Node const &config)
 				return;
 			}
 
-			if (_server_appeared_or_disappeared || child.uncertain_dependencies())
+			auto affected = [&] {
+				if (!_changed_services.any())
+					return false;
+
+				if (child.stuck())
+					return true;
+
+				return child.any_session_to([&] (Service::Name const &name) {
+					return _changed_services.affects(name); });
+			};
+
+			if (child.uncertain_dependencies() || affected())
 				child.evaluate_dependencies();
 
 			if (child.restart_scheduled())
@@ -26,6 +26,7 @@
 #include <vfs/directory_service.h>
 #include <vfs/file_io_service.h>
 #include <vfs/file_system_factory.h>
+#include <vfs/ip_datagram.h>
 #include <vfs/vfs_handle.h>
 #include <timer_session/connection.h>
 
@@ -138,6 +139,8 @@ namespace Vfs_ip {
 
 	class Ip_file;
 	class Ip_data_file;
+	class Ip_datagrams_file;
+	class Ip_datagram_slot_file;
 	class Ip_bind_file;
 	class Ip_accept_file;
 	class Ip_connect_file;
@@ -509,6 +512,178 @@ class Vfs_ip::Ip_data_file final : public Vfs_ip::Ip_file
 };
 
 
+class Vfs_ip::Ip_datagrams_file final : public Vfs_ip::Ip_file
+{
+	private:
+
+		using Record = Vfs::Ip_datagram;
+
+		/* payload limit per record of a read, set via 'datagram_slot' */
+		size_t _slot = Record::MAX_PAYLOAD;
+
+	public:
+
+		Ip_datagrams_file(Ip::Socket_dir &p, genode_socket_handle &s)
+		: Ip_file(p, s, "datagrams") { }
+
+		size_t slot() const { return _slot; }
+
+		void slot(size_t slot)
+		{
+			_slot = min(max(slot, size_t(1)), Record::MAX_PAYLOAD);
+		}
+
+		/********************
+		 ** File interface **
+		 ********************/
+
+		bool read_ready() const override
+		{
+			return genode_socket_poll(&_sock) & genode_socket_pollin_set();
+		}
+
+		bool write_ready() const override
+		{
+			return genode_socket_poll(&_sock) & genode_socket_pollout_set();
+		}
+
+		long write(Ip_vfs_file_handle &,
+		           Const_byte_range_ptr const &src,
+		           file_size /* ignored */) override
+		{
+			size_t offset = 0;
+
+			while (offset + sizeof(Record) <= src.num_bytes) {
+
+				Record const &record = *(Record const *)(src.start + offset);
+
+				if (offset + sizeof(Record) + record.length > src.num_bytes)
+					break;
+
+				genode_sockaddr addr { .family = AF_INET };
+				addr.in.port = record.port;
+				addr.in.addr = record.addr;
+
+				Msg_header msg_send { addr, record.payload(), record.length };
+
+				if (!record.addr && !record.port)
+					msg_send.name(_parent.remote_addr());
+
+				unsigned long bytes_sent = 0;
+				_write_err = genode_socket_sendmsg(&_sock, msg_send.header(), &bytes_sent);
+
+				/* report the records sent so far, propagate EAGAIN otherwise */
+				if (_write_err == GENODE_EAGAIN) {
+					if (offset == 0)
+						throw Would_block();
+
+					_write_err = GENODE_ENONE;
+					break;
+				}
+
+				if (_write_err != GENODE_ENONE)
+					break;
+
+				offset += Record::record_size(record.length);
+			}
+
+			return offset ? long(min(offset, src.num_bytes)) : -1;
+		}
+
+		long read(Ip_vfs_file_handle &,
+		          Byte_range_ptr const &dst,
+		          file_size /* ignored */) override
+		{
+			size_t const max_payload = _slot;
+			size_t offset = 0;
+
+			while (offset + sizeof(Record) < dst.num_bytes) {
+
+				size_t const avail = dst.num_bytes - offset - sizeof(Record);
+
+				/* leave datagrams that may not fit for the next read */
+				if (offset && avail < max_payload)
+					break;
+
+				Record &record = *(Record *)(dst.start + offset);
+
+				genode_sockaddr addr { .family = AF_INET };
+				unsigned long   bytes = 0;
+				Msg_header      msg_recv { addr, record.payload(), min(avail, max_payload) };
+
+				Errno const err = genode_socket_recvmsg(&_sock, msg_recv.header(), &bytes, false);
+
+				if (err == GENODE_EAGAIN) {
+					if (offset == 0)
+						throw Would_block();
+					break;
+				}
+
+				if (err != GENODE_ENONE)
+					return offset ? long(offset) : -1;
+
+				record.addr   = addr.in.addr;
+				record.port   = addr.in.port;
+				record.length = uint16_t(bytes);
+
+				offset += Record::record_size(bytes);
+			}
+
+			return long(min(offset, dst.num_bytes));
+		}
+};
+
+
+/**
+ * Payload limit per record of reads from the 'datagrams' file
+ */
+class Vfs_ip::Ip_datagram_slot_file final : public Vfs_ip::Ip_file
+{
+	private:
+
+		Ip_datagrams_file &_datagrams_file;
+
+	public:
+
+		Ip_datagram_slot_file(Ip::Socket_dir &p, genode_socket_handle &s,
+		                      Ip_datagrams_file &datagrams_file)
+		:
+			Ip_file(p, s, "datagram_slot"), _datagrams_file(datagrams_file)
+		{ }
+
+		/********************
+		 ** File interface **
+		 ********************/
+
+		bool read_ready()  const override { return true; }
+		bool write_ready() const override { return true; }
+
+		long write(Ip_vfs_file_handle &handle,
+		           Const_byte_range_ptr const &src,
+		           file_size /* ignored */) override
+		{
+			if (!handle.write_content_line(src)) return -1;
+
+			unsigned long slot = 0;
+			Genode::ascii_to_unsigned(
+				handle.content_buffer, slot, sizeof(handle.content_buffer));
+
+			if (slot == 0 || slot > Vfs::Ip_datagram::MAX_PAYLOAD) return -1;
+
+			_datagrams_file.slot(slot);
+			return src.num_bytes;
+		}
+
+		long read(Ip_vfs_file_handle &,
+		          Byte_range_ptr const &dst,
+		          file_size /* ignored */) override
+		{
+			return Format::snprintf(dst.start, dst.num_bytes, "%lu\n",
+			                        (unsigned long)_datagrams_file.slot());
+		}
+};
+
+
 class Vfs_ip::Ip_peek_file final : public Vfs_ip::Ip_file
 {
 	public:
@@ -913,7 +1088,7 @@ class Vfs_ip::Ip_socket_dir final : public Ip::Socket_dir
 
 		enum {
 			ACCEPT_NODE, BIND_NODE, CONNECT_NODE,
-			DATA_NODE, PEEK_NODE,
+			DATA_NODE, DATAGRAMS_NODE, DATAGRAM_SLOT_NODE, PEEK_NODE,
 			LOCAL_NODE, LISTEN_NODE, REMOTE_NODE,
 			ACCEPT_SOCKET_NODE,
 			MAX_FILES
@@ -936,14 +1111,18 @@ class Vfs_ip::Ip_socket_dir final : public Ip::Socket_dir
 			return num;
 		}
 
-		Ip_accept_file  _accept_file  { *this, _sock };
-		Ip_bind_file    _bind_file    { *this, _sock };
-		Ip_connect_file _connect_file { *this, _sock };
-		Ip_data_file    _data_file    { *this, _sock };
-		Ip_peek_file    _peek_file    { *this, _sock };
-		Ip_listen_file  _listen_file  { *this, _sock };
-		Ip_local_file   _local_file   { *this, _sock };
-		Ip_remote_file  _remote_file  { *this, _sock };
+		Ip_accept_file    _accept_file    { *this, _sock };
+		Ip_bind_file      _bind_file      { *this, _sock };
+		Ip_connect_file   _connect_file   { *this, _sock };
+		Ip_data_file      _data_file      { *this, _sock };
+		Ip_datagrams_file _datagrams_file { *this, _sock };
+
+		Ip_datagram_slot_file _datagram_slot_file { *this, _sock, _datagrams_file };
+
+		Ip_peek_file      _peek_file      { *this, _sock };
+		Ip_listen_file    _listen_file    { *this, _sock };
+		Ip_local_file     _local_file     { *this, _sock };
+		Ip_remote_file    _remote_file    { *this, _sock };
 
 		struct Accept_socket_file : Vfs_ip::File
 		{
@@ -982,6 +1161,12 @@ class Vfs_ip::Ip_socket_dir final : public Ip::Socket_dir
 			_files[LISTEN_NODE]  = &_listen_file;
 			_files[LOCAL_NODE]   = &_local_file;
 			_files[REMOTE_NODE]  = &_remote_file;
+
+			/* batched datagram I/O, used by 'recvmmsg' and 'sendmmsg' */
+			if (_parent.type() == Ip::Protocol_dir::TYPE_DGRAM) {
+				_files[DATAGRAMS_NODE]     = &_datagrams_file;
+				_files[DATAGRAM_SLOT_NODE] = &_datagram_slot_file;
+			}
 		}
 
 		~Ip_socket_dir()
@@ -990,6 +1175,8 @@ class Vfs_ip::Ip_socket_dir final : public Ip::Socket_dir
 			_bind_file.dissolve_handles();
 			_connect_file.dissolve_handles();
 			_data_file.dissolve_handles();
+			_datagrams_file.dissolve_handles();
+			_datagram_slot_file.dissolve_handles();
 			_peek_file.dissolve_handles();
 			_listen_file.dissolve_handles();
 			_local_file.dissolve_handles();
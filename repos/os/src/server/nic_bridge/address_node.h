@@ -15,7 +15,6 @@
 #define _ADDRESS_NODE_H_
 
 /* Genode */
-#include <util/avl_tree.h>
 #include <util/list.h>
 #include <nic_session/nic_session.h>
 #include <net/netaddress.h>
@@ -30,25 +29,39 @@ namespace Net {
 
 	/**
 	 * An Address_node encapsulates a session-component and can be hold in
-	 * a list and/or avl-tree, whereby the network-address (MAC or IP)
-	 * acts as a key.
+	 * a list and/or an address table, whereby the network-address (MAC or
+	 * IP) acts as a key.
 	 */
 	template <typename ADDRESS> class Address_node;
 
+	/**
+	 * Hash table of address nodes with constant-time lookup
+	 */
+	template <typename ADDRESS> class Address_table;
+
 	using Ipv4_address_node = Address_node<Ipv4_address>;
 	using Mac_address_node  = Address_node<Mac_address>;
 }
 
 
 template <typename ADDRESS>
-class Net::Address_node : public Genode::Avl_node<Address_node<ADDRESS> >,
-                          public Genode::List<Address_node<ADDRESS> >::Element
+class Net::Address_node : public Genode::List<Address_node<ADDRESS> >::Element
 {
 	private:
 
+		friend class Address_table<ADDRESS>;
+
 		ADDRESS            _addr;       /* MAC or IP address  */
 		Session_component &_component;  /* client's component */
 
+		Address_node *_bucket_next { nullptr };  /* chain of table bucket */
+
+		/*
+		 * Noncopyable
+		 */
+		Address_node(Address_node const &);
+		Address_node &operator = (Address_node const &);
+
 	public:
 
 		using Address = ADDRESS;
@@ -71,33 +84,78 @@ class Net::Address_node : public Genode::Avl_node<Address_node<ADDRESS> >,
 		Address            addr()       const { return _addr;      }
 		Session_component &component()        { return _component; }
 
+};
+
+template <typename ADDRESS>
+class Net::Address_table
+{
+	private:
+
+		using Node = Address_node<ADDRESS>;
+
+		enum { BUCKETS = 256 };
+
+		Node *_buckets[BUCKETS] { };
+
+		/**
+		 * Return bucket for address, hashed via FNV-1a
+		 */
+		Node *&_bucket(ADDRESS const &addr)
+		{
+			Genode::uint32_t hash = 2166136261u;
+			for (Genode::uint8_t const byte : addr.addr)
+				hash = (hash ^ byte)*16777619u;
+
+			return _buckets[hash % BUCKETS];
+		}
 
-		/************************
-		 ** Avl node interface **
-		 ************************/
+		/*
+		 * Noncopyable
+		 */
+		Address_table(Address_table const &);
+		Address_table &operator = (Address_table const &);
 
-		bool higher(Address_node *c)
+	public:
+
+		Address_table() { }
+
+		/**
+		 * Insert node, which must not be part of the table already
+		 */
+		void insert(Node &node)
 		{
-			using namespace Genode;
+			Node *&head = _bucket(node._addr);
 
-			return (memcmp(&c->_addr.addr, &_addr.addr,
-			               sizeof(_addr.addr)) > 0);
+			node._bucket_next = head;
+			head = &node;
 		}
 
 		/**
-		 * Find by address
+		 * Remove node if part of the table
+		 *
+		 * The node must still carry the address it was inserted with.
 		 */
-		Address_node *find_by_address(Address addr)
+		void remove(Node &node)
 		{
-			using namespace Genode;
+			for (Node **n = &_bucket(node._addr); *n; n = &(*n)->_bucket_next) {
+				if (*n == &node) {
+					*n = node._bucket_next;
+					node._bucket_next = nullptr;
+					return;
+				}
+			}
+		}
 
-			if (addr == _addr)
-				return this;
+		/**
+		 * Find by address
+		 */
+		Node *find_by_address(ADDRESS const &addr)
+		{
+			for (Node *n = _bucket(addr); n; n = n->_bucket_next)
+				if (n->_addr == addr)
+					return n;
 
-			bool side = memcmp(&addr.addr, _addr.addr,
-			                   sizeof(_addr.addr)) > 0;
-			Address_node *c = Avl_node<Address_node>::child(side);
-			return c ? c->find_by_address(addr) : 0;
+			return nullptr;
 		}
 };
 
@@ -33,9 +33,7 @@ bool Net::Nic::handle_arp(Ethernet_frame &eth,
 		return true;
 
 	/* look whether the IP address is one of our client's */
-	Ipv4_address_node *node = vlan().ip_tree.first();
-	if (node)
-		node = node->find_by_address(arp.dst_ip());
+	Ipv4_address_node *node = vlan().ip_table.find_by_address(arp.dst_ip());
 	if (node) {
 		if (arp.opcode() == Arp_packet::REQUEST) {
 			/*
@@ -91,9 +89,7 @@ bool Net::Nic::handle_ip(Ethernet_frame &eth,
 					 */
 					if (msg_type == Dhcp_packet::Message_type::ACK) {
 						Mac_address_node *node =
-							vlan().mac_tree.first();
-						if (node)
-							node = node->find_by_address(dhcp.client_mac());
+							vlan().mac_table.find_by_address(dhcp.client_mac());
 						if (node)
 							node->component().set_ipv4_address(dhcp.yiaddr());
 					}
@@ -105,17 +101,14 @@ bool Net::Nic::handle_ip(Ethernet_frame &eth,
 
 	/* is it an unicast message to one of our clients ? */
 	if (eth.dst() == mac()) {
-		Ipv4_address_node *node = vlan().ip_tree.first();
+		Ipv4_address_node *node = vlan().ip_table.find_by_address(ip.dst());
 		if (node) {
-			node = node->find_by_address(ip.dst());
-			if (node) {
-				/* overwrite destination MAC */
-				eth.dst(node->component().mac_address().addr);
-
-				/* deliver the packet to the client */
-				node->component().send(&eth, size_guard.total_size());
-				return false;
-			}
+			/* overwrite destination MAC */
+			eth.dst(node->component().mac_address().addr);
+
+			/* deliver the packet to the client */
+			node->component().send(&eth, size_guard.total_size());
+			return false;
 		}
 	}
 	return true;
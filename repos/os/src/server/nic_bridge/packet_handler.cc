@@ -23,21 +23,36 @@
 
 using namespace Net;
 
+void Packet_handler::_wakeup_pending_handlers()
+{
+	while (Packet_handler *handler = _vlan.pending_wakeups.first()) {
+		_vlan.pending_wakeups.remove(handler);
+		handler->_wakeup_pending = false;
+		handler->source()->wakeup();
+	}
+}
+
+
 void Packet_handler::_ready_to_submit()
 {
 	/* as long as packets are available, and we can ack them */
 	while (sink()->packet_avail()) {
-		_packet = sink()->get_packet();
-		if (!_packet.size() || !sink()->packet_valid(_packet)) continue;
-		handle_ethernet(sink()->packet_content(_packet), _packet.size());
 
-		if (!sink()->ready_to_ack()) {
+		if (!sink()->ack_slots_free()) {
 			Genode::warning("ack state FULL");
-			return;
+			break;
 		}
 
-		sink()->acknowledge_packet(_packet);
+		_packet = sink()->try_get_packet();
+		if (!_packet.size() || !sink()->packet_valid(_packet)) continue;
+		handle_ethernet(sink()->packet_content(_packet), _packet.size());
+
+		(void)sink()->try_ack_packet(_packet);
 	}
+
+	/* signal the whole batch to the receivers and to the sender */
+	_wakeup_pending_handlers();
+	sink()->wakeup();
 }
 
 
@@ -45,7 +60,9 @@ void Packet_handler::_ready_to_ack()
 {
 	/* check for acknowledgements */
 	while (source()->ack_avail())
-		source()->release_packet(source()->get_acked_packet());
+		source()->release_packet(source()->try_get_acked_packet());
+
+	source()->wakeup();
 }
 
 
@@ -109,14 +126,25 @@ void Packet_handler::send(Ethernet_frame *eth, Genode::size_t size)
 {
 	if (_verbose) {
 		Genode::log("[", _label, "] snd ", *eth); }
+	if (!source()->ready_to_submit()) {
+		Genode::warning("Packet dropped");
+		return;
+	}
+
 	try {
 		/* copy and submit packet */
 		Packet_descriptor packet  = source()->alloc_packet(size);
 		char             *content = source()->packet_content(packet);
 		Genode::memcpy((void*)content, (void*)eth, size);
-		source()->submit_packet(packet);
+		(void)source()->try_submit_packet(packet);
 	} catch(Packet_stream_source< ::Nic::Session::Policy>::Packet_alloc_failed) {
 		Genode::warning("Packet dropped");
+		return;
+	}
+
+	if (!_wakeup_pending) {
+		_wakeup_pending = true;
+		_vlan.pending_wakeups.insert(this);
 	}
 }
 
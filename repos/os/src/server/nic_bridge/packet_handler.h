@@ -35,14 +35,25 @@ namespace Net {
 /**
  * Generic packet handler used as base for NIC and client packet handlers.
  */
-class Net::Packet_handler
+class Net::Packet_handler : private Genode::List<Packet_handler>::Element
 {
 	private:
 
+		friend class Genode::List<Packet_handler>;
+
 		Packet_descriptor      _packet { };
 		Net::Vlan             &_vlan;
 		Genode::Session_label  _label;
 		bool            const &_verbose;
+		bool                   _wakeup_pending { false };
+
+		/**
+		 * Signal all packets submitted to other handlers at once
+		 *
+		 * Packets are submitted without signalling the receiving side.
+		 * Each receiver is woken up only once per batch of packets.
+		 */
+		void _wakeup_pending_handlers();
 
 		/**
 		 * submit queue not empty anymore
@@ -90,7 +101,11 @@ class Net::Packet_handler
 		               Genode::Session_label const &label,
 		               bool                  const &verbose);
 
-		virtual ~Packet_handler() { }
+		virtual ~Packet_handler()
+		{
+			if (_wakeup_pending)
+				_vlan.pending_wakeups.remove(this);
+		}
 
 		virtual Packet_stream_sink< ::Nic::Session::Policy>   * sink()   = 0;
 		virtual Packet_stream_source< ::Nic::Session::Policy> * source() = 0;
@@ -112,6 +127,9 @@ class Net::Packet_handler
 		 *
 		 * \param eth   ethernet frame to send.
 		 * \param size  ethernet frame's size.
+		 *
+		 * The receiver is signalled at the end of the currently handled
+		 * batch of packets.
 		 */
 		void send(Ethernet_frame *eth, Genode::size_t size);
 
@@ -3,7 +3,7 @@
  * \author Stefan Kalkowski
  * \date   2010-08-18
  *
- * A database containing all clients sorted by IP and MAC addresses.
+ * A database containing all clients indexed by IP and MAC addresses.
  */
 
 /*
@@ -16,25 +16,30 @@
 #ifndef _VLAN_H_
 #define _VLAN_H_
 
-#include <util/avl_tree.h>
 #include <util/list.h>
 #include <address_node.h>
 
 namespace Net {
 
+	class Packet_handler;
+
 	/*
 	 * The Vlan is a database containing all clients
-	 * sorted by IP and MAC addresses.
+	 * indexed by IP and MAC addresses.
 	 */
 	struct Vlan
 	{
-		using Mac_address_tree  = Genode::Avl_tree<Mac_address_node>;
-		using Ipv4_address_tree = Genode::Avl_tree<Ipv4_address_node>;
-		using Mac_address_list  = Genode::List<Mac_address_node>;
+		using Mac_address_table   = Address_table<Mac_address>;
+		using Ipv4_address_table  = Address_table<Ipv4_address>;
+		using Mac_address_list    = Genode::List<Mac_address_node>;
+		using Packet_handler_list = Genode::List<Packet_handler>;
+
+		Mac_address_table   mac_table { };
+		Mac_address_list    mac_list  { };
+		Ipv4_address_table  ip_table  { };
 
-		Mac_address_tree  mac_tree { };
-		Mac_address_list  mac_list { };
-		Ipv4_address_tree ip_tree  { };
+		/* handlers with submitted packets that are not signalled yet */
+		Packet_handler_list pending_wakeups { };
 	};
 }
 
@@ -16,6 +16,9 @@
 #include <domain.h>
 #include <configuration.h>
 
+/* Genode includes */
+#include <util/construct_at.h>
+
 using namespace Net;
 using namespace Genode;
 
@@ -31,12 +34,6 @@ Arp_cache_entry::Arp_cache_entry(Ipv4_address const &ip,
 { }
 
 
-bool Arp_cache_entry::_higher(Ipv4_address const &ip) const
-{
-	return memcmp(ip.addr, _ip.addr, sizeof(_ip.addr)) > 0;
-}
-
-
 void Arp_cache_entry::print(Output &output) const
 {
 	Genode::print(output, _ip, " > ", _mac);
@@ -47,28 +44,148 @@ void Arp_cache_entry::print(Output &output) const
  ** Arp_cache **
  ***************/
 
-void Arp_cache::new_entry(Ipv4_address const &ip, Mac_address const &mac)
+unsigned long Arp_cache::_new_generation()
+{
+	static unsigned long generation = 0;
+	return ++generation;
+}
+
+
+unsigned Arp_cache::_nr_of_buckets(unsigned nr_of_entries)
+{
+	unsigned nr_of_buckets = 1;
+	while (nr_of_buckets < nr_of_entries)
+		nr_of_buckets <<= 1;
+
+	return nr_of_buckets;
+}
+
+
+size_t Arp_cache::_ram_size() const
+{
+	return _nr_of_entries * sizeof(Arp_cache_entry_slot) +
+	       (_bucket_mask + 1) * sizeof(Arp_cache_entry *);
+}
+
+
+Arp_cache_entry *&Arp_cache::_bucket(Ipv4_address const &ip) const
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261u;
+	for (uint8_t byte : ip.addr)
+		hash = (hash ^ byte) * 16777619u;
+
+	return _buckets[hash & _bucket_mask];
+}
+
+
+Arp_cache::Arp_cache(Domain const &domain,
+                     Allocator    &alloc,
+                     unsigned      nr_of_entries)
+:
+	_domain(domain), _alloc(alloc),
+	_nr_of_entries(min(max(nr_of_entries, 1U), (unsigned)MAX_NR_OF_ENTRIES)),
+	_bucket_mask(_nr_of_buckets(_nr_of_entries) - 1),
+	_entries((Arp_cache_entry_slot *)_alloc.alloc(_ram_size())),
+	_buckets((Arp_cache_entry **)(_entries + _nr_of_entries)),
+	_generation(_new_generation())
+{
+	for (unsigned i = 0; i < _nr_of_entries; i++)
+		construct_at<Arp_cache_entry_slot>(&_entries[i]);
+
+	for (unsigned i = 0; i <= _bucket_mask; i++)
+		_buckets[i] = nullptr;
+}
+
+
+Arp_cache::~Arp_cache()
 {
-	if (_entries[_curr].constructed()) {
-		remove(&(*_entries[_curr]));
+	for (unsigned i = 0; i < _nr_of_entries; i++)
+		_entries[i].~Arp_cache_entry_slot();
+
+	_alloc.free(_entries, _ram_size());
+}
+
+
+void Arp_cache::_destroy_entry(Arp_cache_entry_slot &slot)
+{
+	Arp_cache_entry **next_ptr = &_bucket(slot->_ip);
+	for (; *next_ptr != &*slot; next_ptr = &(*next_ptr)->_bucket_next);
+
+	*next_ptr = slot->_bucket_next;
+	slot.destruct();
+	_nr_of_used--;
+	_generation = _new_generation();
+}
+
+
+Arp_cache_entry_slot &Arp_cache::_free_slot()
+{
+	bool const full = _nr_of_used == _nr_of_entries;
+	for (;;) {
+		Arp_cache_entry_slot &slot = _entries[_curr];
+		_curr = (_curr + 1) % _nr_of_entries;
+
+		if (!slot.constructed())
+			return slot;
+
+		if (!full)
+			continue;
+
+		/* give entries that were looked up recently a second chance */
+		if (slot->_referenced) {
+			slot->_referenced = false;
+			continue;
+		}
+		if (_domain.config().verbose()) {
+			log("[", _domain, "] replace ARP entry ", *slot);
+		}
+		_destroy_entry(slot);
+		return slot;
 	}
-	_entries[_curr].construct(ip, mac);
-	Arp_cache_entry &entry = *_entries[_curr];
-	insert(&entry);
+}
+
+
+void Arp_cache::new_entry(Ipv4_address const &ip, Mac_address const &mac)
+{
+	Arp_cache_entry_slot &slot = _free_slot();
+	slot.construct(ip, mac);
+	_nr_of_used++;
+
+	Arp_cache_entry &entry = *slot;
+	Arp_cache_entry *&bucket = _bucket(ip);
+	entry._bucket_next = bucket;
+	bucket = &entry;
+
 	if (_domain.config().verbose()) {
 		log("[", _domain, "] new ARP entry ", entry);
 	}
-	if (_curr < NR_OF_ENTRIES - 1) {
-		_curr++;
-	} else {
-		_curr = 0;
-	};
+}
+
+
+void Arp_cache::refresh_entry(Ipv4_address const &ip, Mac_address const &mac)
+{
+	for (Arp_cache_entry *entry = _bucket(ip); entry; entry = entry->_bucket_next) {
+
+		if (entry->_ip != ip)
+			continue;
+
+		if (entry->_mac == mac)
+			return;
+
+		entry->_mac = mac;
+		_generation = _new_generation();
+		if (_domain.config().verbose()) {
+			log("[", _domain, "] refresh ARP entry ", *entry);
+		}
+		return;
+	}
 }
 
 
 void Arp_cache::destroy_entries_with_mac(Mac_address const &mac)
 {
-	for (unsigned curr = 0; curr < NR_OF_ENTRIES; curr++) {
+	for (unsigned curr = 0; curr < _nr_of_entries; curr++) {
 		if (_entries[curr].constructed()) {
 			Arp_cache_entry &entry = *_entries[curr];
 			if (entry.mac() != mac) {
@@ -77,8 +194,7 @@ void Arp_cache::destroy_entries_with_mac(Mac_address const &mac)
 			if (_domain.config().verbose()) {
 				log("[", _domain, "] destroy ARP entry ", entry);
 			}
-			remove(&entry);
-			_entries[curr].destruct();
+			_destroy_entry(_entries[curr]);
 		}
 	}
 }
@@ -89,10 +205,13 @@ void Arp_cache::destroy_all_entries()
 	if (_domain.config().verbose()) {
 		log("[", _domain, "] destroy all ARP entries");
 	}
-	while (Arp_cache_entry *entry = first()) {
-		remove(entry);
-	}
-	for (unsigned curr = 0; curr < NR_OF_ENTRIES; curr++) {
+	for (unsigned curr = 0; curr < _nr_of_entries; curr++) {
 		_entries[curr].destruct();
 	}
+	for (unsigned i = 0; i <= _bucket_mask; i++) {
+		_buckets[i] = nullptr;
+	}
+	_nr_of_used = 0;
+	_curr       = 0;
+	_generation = _new_generation();
 }
@@ -17,9 +17,10 @@
 /* Genode includes */
 #include <net/ipv4.h>
 #include <net/ethernet.h>
-#include <util/avl_tree.h>
 #include <util/reconstructible.h>
 
+namespace Genode { class Allocator; }
+
 namespace Net {
 
 	class Domain;
@@ -29,49 +30,27 @@ namespace Net {
 }
 
 
-class Net::Arp_cache_entry : public Genode::Avl_node<Arp_cache_entry>
+class Net::Arp_cache_entry
 {
+	friend class Arp_cache;
+
 	private:
 
-		Ipv4_address const _ip;
-		Mac_address  const _mac;
+		Ipv4_address const  _ip;
+		Mac_address         _mac;
+		Arp_cache_entry    *_bucket_next { nullptr };
+		bool mutable        _referenced  { true };
 
-		bool _higher(Ipv4_address const &ip) const;
+		/*
+		 * Noncopyable
+		 */
+		Arp_cache_entry(Arp_cache_entry const &);
+		Arp_cache_entry &operator = (Arp_cache_entry const &);
 
 	public:
 
 		Arp_cache_entry(Ipv4_address const &ip, Mac_address const &mac);
 
-		void find_by_ip(Ipv4_address const &ip, auto const &handle_match, auto const &handle_no_match) const
-		{
-			if (ip != _ip) {
-
-				Arp_cache_entry *const entry_ptr {
-					Avl_node<Arp_cache_entry>::child(
-						_higher(ip)) };
-
-				if (entry_ptr != nullptr) {
-
-					entry_ptr->find_by_ip(
-						ip, handle_match, handle_no_match);
-
-				} else {
-
-					handle_no_match();
-				}
-			} else {
-
-				handle_match(*this);
-			}
-		}
-
-
-		/**************
-		 ** Avl_node **
-		 **************/
-
-		bool higher(Arp_cache_entry *entry) { return _higher(entry->_ip); }
-
 
 		/***************
 		 ** Accessors **
@@ -89,40 +68,84 @@ class Net::Arp_cache_entry : public Genode::Avl_node<Arp_cache_entry>
 };
 
 
-class Net::Arp_cache : public Genode::Avl_tree<Arp_cache_entry>
+/**
+ * Hash table of ARP entries with a fixed number of slots
+ *
+ * Once all slots are in use, a new entry replaces an entry that wasn't
+ * looked up since the last pass of the replacement cursor (clock algorithm),
+ * which keeps entries of active peers in the cache.
+ *
+ * The generation number changes whenever an entry is removed or changes its
+ * MAC address. Thus, a MAC address that was looked up in the cache remains
+ * valid as long as the generation number is the same. Generation numbers are
+ * unique among all ARP caches.
+ */
+class Net::Arp_cache
 {
 	private:
 
-		enum {
-			ENTRIES_SIZE  = 1024 * sizeof(Genode::addr_t),
-			NR_OF_ENTRIES = ENTRIES_SIZE / sizeof(Arp_cache_entry),
-		};
+		Domain             const &_domain;
+		Genode::Allocator        &_alloc;
+		unsigned           const  _nr_of_entries;
+		unsigned           const  _bucket_mask;
+		Arp_cache_entry_slot     *_entries;
+		Arp_cache_entry         **_buckets;
+		unsigned                  _nr_of_used { 0 };
+		unsigned                  _curr { 0 };
+		unsigned long             _generation;
+
+		static unsigned long _new_generation();
+
+		static unsigned _nr_of_buckets(unsigned nr_of_entries);
+
+		Genode::size_t _ram_size() const;
 
-		Domain const         &_domain;
-		Arp_cache_entry_slot  _entries[NR_OF_ENTRIES];
-		unsigned              _curr = 0;
+		Arp_cache_entry *&_bucket(Ipv4_address const &ip) const;
+
+		void _destroy_entry(Arp_cache_entry_slot &slot);
+
+		Arp_cache_entry_slot &_free_slot();
+
+		/*
+		 * Noncopyable
+		 */
+		Arp_cache(Arp_cache const &);
+		Arp_cache &operator = (Arp_cache const &);
 
 	public:
 
-		Arp_cache(Domain const &domain) : _domain(domain) { }
+		enum { DEFAULT_NR_OF_ENTRIES = 256, MAX_NR_OF_ENTRIES = 4096 };
+
+		Arp_cache(Domain const      &domain,
+		          Genode::Allocator &alloc,
+		          unsigned           nr_of_entries);
+
+		~Arp_cache();
 
 		void new_entry(Ipv4_address const &ip, Mac_address const &mac);
 
+		/**
+		 * Update the MAC address of an existing entry
+		 */
+		void refresh_entry(Ipv4_address const &ip, Mac_address const &mac);
+
 		void destroy_entries_with_mac(Mac_address const &mac);
 
 		void find_by_ip(Ipv4_address const &ip, auto const &handle_match, auto const &handle_no_match) const
 		{
-			if (first() != nullptr) {
-
-				first()->find_by_ip(ip, handle_match, handle_no_match);
-
-			} else {
-
-				handle_no_match();
+			for (Arp_cache_entry *entry = _bucket(ip); entry; entry = entry->_bucket_next) {
+				if (entry->_ip == ip) {
+					entry->_referenced = true;
+					handle_match(*entry);
+					return;
+				}
 			}
+			handle_no_match();
 		}
 
 		void destroy_all_entries();
+
+		unsigned long generation() const { return _generation; }
 };
 
 #endif /* _ARP_CACHE_H_ */
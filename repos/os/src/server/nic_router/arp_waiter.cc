@@ -28,7 +28,8 @@ Arp_waiter::Arp_waiter(Interface                 &src,
                        Cached_timer              &timer)
 :
 	_src_le(this), _src(src), _dst_le(this), _dst_ptr(&dst), _ip(ip),
-	_timeout(timer, *this, &Arp_waiter::_handle_timeout, timeout)
+	_timeout(timer, *this, &Arp_waiter::_handle_timeout, timeout),
+	_created_us(timer.cached_time().trunc_to_plain_us().value)
 {
 	_src.arp_stats().alive++;
 	_src.own_arp_waiters().insert(&_src_le);
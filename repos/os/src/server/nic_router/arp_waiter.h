@@ -57,6 +57,7 @@ class Net::Arp_waiter
 		Ipv4_address               const  _ip;
 		Packet_list                       _packets { };
 		Lazy_one_shot_timeout<Arp_waiter> _timeout;
+		Genode::uint64_t           const  _created_us;
 
 		/*
 		 * Noncopyable
@@ -104,9 +105,10 @@ class Net::Arp_waiter
 		 ** Accessors **
 		 ***************/
 
-		Interface          &src() const { return _src; }
-		Ipv4_address const &ip()  const { return _ip; }
-		Domain             &dst()       { return *_dst_ptr; }
+		Interface          &src()        const { return _src; }
+		Ipv4_address const &ip()         const { return _ip; }
+		Domain             &dst()              { return *_dst_ptr; }
+		Genode::uint64_t    created_us() const { return _created_us; }
 };
 
 
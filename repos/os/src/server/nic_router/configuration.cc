@@ -41,6 +41,7 @@ Configuration::Configuration(Node const &node, Allocator &alloc)
 	_dhcp_discover_timeout          { 0 },
 	_dhcp_request_timeout           { 0 },
 	_dhcp_offer_timeout             { 0 },
+	_dhcp_requests_per_sec          { 0 },
 	_icmp_idle_timeout              { 0 },
 	_udp_idle_timeout               { 0 },
 	_tcp_idle_timeout               { 0 },
@@ -101,6 +102,7 @@ Configuration::Configuration(Env                             &env,
 	_dhcp_discover_timeout          { read_sec_attr(node,  "dhcp_discover_timeout_sec", 10) },
 	_dhcp_request_timeout           { read_sec_attr(node,  "dhcp_request_timeout_sec",  10) },
 	_dhcp_offer_timeout             { read_sec_attr(node,  "dhcp_offer_timeout_sec",    10) },
+	_dhcp_requests_per_sec          { node.attribute_value("dhcp_requests_per_sec",     (unsigned long)100) },
 	_icmp_idle_timeout              { read_sec_attr(node,  "icmp_idle_timeout_sec",     10) },
 	_udp_idle_timeout               { read_sec_attr(node,  "udp_idle_timeout_sec",      30) },
 	_tcp_idle_timeout               { read_sec_attr(node,  "tcp_idle_timeout_sec",      600) },
@@ -43,6 +43,7 @@ class Net::Configuration
 		Genode::Microseconds    const  _dhcp_discover_timeout;
 		Genode::Microseconds    const  _dhcp_request_timeout;
 		Genode::Microseconds    const  _dhcp_offer_timeout;
+		unsigned long           const  _dhcp_requests_per_sec;
 		Genode::Microseconds    const  _icmp_idle_timeout;
 		Genode::Microseconds    const  _udp_idle_timeout;
 		Genode::Microseconds    const  _tcp_idle_timeout;
@@ -84,6 +85,11 @@ class Net::Configuration
 
 		void with_report(auto const &fn) { if (_report.constructed()) fn(*_report); }
 
+		/**
+		 * Return whether packet statistics are collected for the report
+		 */
+		bool packet_stats() const { return _report.constructed() && _report->packet_stats(); }
+
 
 		/***************
 		 ** Accessors **
@@ -100,6 +106,7 @@ class Net::Configuration
 		Genode::Microseconds  dhcp_discover_timeout()          const { return _dhcp_discover_timeout; }
 		Genode::Microseconds  dhcp_request_timeout()           const { return _dhcp_request_timeout; }
 		Genode::Microseconds  dhcp_offer_timeout()             const { return _dhcp_offer_timeout; }
+		unsigned long         dhcp_requests_per_sec()          const { return _dhcp_requests_per_sec; }
 		Genode::Microseconds  icmp_idle_timeout()              const { return _icmp_idle_timeout; }
 		Genode::Microseconds  udp_idle_timeout()               const { return _udp_idle_timeout; }
 		Genode::Microseconds  tcp_idle_timeout()               const { return _tcp_idle_timeout; }
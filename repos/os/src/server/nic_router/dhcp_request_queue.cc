@@ -0,0 +1,56 @@
+/*
+ * \brief  Rate-limited queue of the DHCP requests received at an interface
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include <dhcp_request_queue.h>
+
+using namespace Net;
+using namespace Genode;
+
+static constexpr uint64_t US_PER_SEC = 1000 * 1000;
+
+
+void Dhcp_request_queue::_refill(uint64_t rate, uint64_t curr_us)
+{
+	if (!_refill_started || curr_us < _refill_us) {
+		_refill_started = true;
+		_tokens         = rate;
+		_refill_us      = curr_us;
+		return;
+	}
+	uint64_t const elapsed_us = curr_us - _refill_us;
+	if (elapsed_us >= US_PER_SEC) {
+		_tokens    = rate;
+		_refill_us = curr_us;
+		return;
+	}
+	uint64_t const new_tokens = elapsed_us * rate / US_PER_SEC;
+	if (!new_tokens)
+		return;
+
+	/* keep the fraction of a token that was not accounted */
+	_refill_us += new_tokens * US_PER_SEC / rate;
+	_tokens     = min(_tokens + new_tokens, rate);
+	if (_tokens == rate)
+		_refill_us = curr_us;
+}
+
+
+uint64_t Dhcp_request_queue::us_until_ready(uint64_t rate, uint64_t curr_us) const
+{
+	if (!rate || _tokens || !_refill_started)
+		return 0;
+
+	uint64_t const ready_us = _refill_us + (US_PER_SEC + rate - 1) / rate;
+	return ready_us > curr_us ? ready_us - curr_us : 0;
+}
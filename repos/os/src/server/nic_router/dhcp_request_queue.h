@@ -0,0 +1,107 @@
+/*
+ * \brief  Rate-limited queue of the DHCP requests received at an interface
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _DHCP_REQUEST_QUEUE_H_
+#define _DHCP_REQUEST_QUEUE_H_
+
+/* Genode includes */
+#include <os/packet_stream.h>
+
+namespace Net {
+
+	using Packet_descriptor = Genode::Packet_descriptor;
+	class Dhcp_request_queue;
+}
+
+
+/**
+ * Bounded FIFO of received DHCP requests that are handled deferred
+ *
+ * The queue merely holds the descriptors of the requests, the packets remain
+ * in the buffer of the sender until they are handled. Requests leave the
+ * queue at no more than a given rate. The rate is enforced through a token
+ * bucket that holds the tokens of one second at most, so a burst of
+ * requests after an idle phase is handled without delay.
+ */
+class Net::Dhcp_request_queue
+{
+	public:
+
+		static constexpr unsigned CAPACITY = 128;
+
+	private:
+
+		Packet_descriptor _packets[CAPACITY] { };
+		unsigned          _head              { 0 };
+		unsigned          _count             { 0 };
+		Genode::uint64_t  _tokens            { 0 };
+		Genode::uint64_t  _refill_us         { 0 };
+		bool              _refill_started    { false };
+
+		Packet_descriptor _dequeue()
+		{
+			Packet_descriptor const pkt = _packets[_head];
+			_head = (_head + 1) % CAPACITY;
+			_count--;
+			return pkt;
+		}
+
+		void _refill(Genode::uint64_t rate, Genode::uint64_t curr_us);
+
+	public:
+
+		bool empty() const { return !_count; }
+		bool full()  const { return _count == CAPACITY; }
+
+		/**
+		 * Append a request, the queue must not be full
+		 */
+		void enqueue(Packet_descriptor const &pkt)
+		{
+			_packets[(_head + _count) % CAPACITY] = pkt;
+			_count++;
+		}
+
+		/**
+		 * Dequeue requests and call 'fn' for each as long as the rate permits
+		 *
+		 * \param rate  maximum number of requests per second, 0 for no limit
+		 */
+		void dequeue_ready(Genode::uint64_t rate, Genode::uint64_t curr_us,
+		                   auto const &fn)
+		{
+			if (rate)
+				_refill(rate, curr_us);
+
+			while (_count && (!rate || _tokens)) {
+				if (rate)
+					_tokens--;
+
+				fn(_dequeue());
+			}
+		}
+
+		/**
+		 * Return the time until the next request can be dequeued
+		 */
+		Genode::uint64_t us_until_ready(Genode::uint64_t rate,
+		                                Genode::uint64_t curr_us) const;
+
+		void dequeue_all(auto const &fn)
+		{
+			while (_count)
+				fn(_dequeue());
+		}
+};
+
+#endif /* _DHCP_REQUEST_QUEUE_H_ */
@@ -220,11 +220,11 @@ bool Dhcp_server::has_invalid_remote_dns_cfg() const
 Dhcp_allocation::Dhcp_allocation(Interface      &interface,
                              Ipv4_address const &ip,
                              Mac_address  const &mac,
-                             Cached_timer       &timer,
+                             Timeout_wheel      &lease_wheel,
                              Microseconds        lifetime)
 :
 	_interface(interface), _ip(ip), _mac(mac),
-	_timeout(timer, *this, &Dhcp_allocation::_handle_timeout)
+	_timeout(lease_wheel, *this, &Dhcp_allocation::_handle_timeout)
 {
 	_interface.dhcp_stats().alive++;
 	_timeout.schedule(lifetime);
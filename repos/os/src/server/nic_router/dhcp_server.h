@@ -19,13 +19,12 @@
 #include <list.h>
 #include <dns.h>
 #include <ipv4_config.h>
-#include <cached_timer.h>
+#include <timeout_wheel.h>
 
 /* Genode includes */
 #include <net/mac_address.h>
 #include <util/noncopyable.h>
 #include <base/node.h>
-#include <timer_session/connection.h>
 
 namespace Net {
 
@@ -169,11 +168,11 @@ class Net::Dhcp_allocation : public  Genode::Avl_node<Dhcp_allocation>,
 {
 	protected:
 
-		Interface                                &_interface;
-		Ipv4_address                       const  _ip;
-		Mac_address                        const  _mac;
-		Timer::One_shot_timeout<Dhcp_allocation>  _timeout;
-		bool                                      _bound { false };
+		Interface                                 &_interface;
+		Ipv4_address                        const  _ip;
+		Mac_address                         const  _mac;
+		Timeout_wheel::Timeout<Dhcp_allocation>    _timeout;
+		bool                                       _bound { false };
 
 		void _handle_timeout(Genode::Duration);
 
@@ -184,7 +183,7 @@ class Net::Dhcp_allocation : public  Genode::Avl_node<Dhcp_allocation>,
 		Dhcp_allocation(Interface            &interface,
 		                Ipv4_address   const &ip,
 		                Mac_address    const &mac,
-		                Cached_timer         &timer,
+		                Timeout_wheel        &lease_wheel,
 		                Genode::Microseconds  lifetime);
 
 		~Dhcp_allocation();
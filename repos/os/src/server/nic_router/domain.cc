@@ -256,6 +256,9 @@ Domain::Domain(Configuration     &config,
 	_node                { alloc, node },
 	_alloc               { alloc },
 	_ip_config           { node, alloc },
+	_arp_cache           { *this, alloc,
+	                       node.attribute_value("arp_cache_entries",
+	                                            (unsigned)Arp_cache::DEFAULT_NR_OF_ENTRIES) },
 	_verbose_packets     { node.attribute_value("verbose_packets",
 	                                            config.verbose_packets()) },
 	_verbose_packet_drop { node.attribute_value("verbose_packet_drop",
@@ -440,12 +443,13 @@ bool Domain::report_empty(Report const &report_cfg) const
 		!_tcp_stats.report_empty() || !_udp_stats.report_empty() ||
 		!_icmp_stats.report_empty() || !_arp_stats.report_empty() || _dhcp_stats.report_empty());
 	bool fragm_ip = report_cfg.dropped_fragm_ipv4() && _dropped_fragm_ipv4;
+	bool pkt_stats = report_cfg.packet_stats() && !_packet_stats.report_empty();
 	bool interfaces = false;
 	_interfaces.for_each([&] (Interface const &interface) {
 		if (!interface.report_empty(report_cfg))
 			interfaces = true; });
 
-	return !bytes && !cfg && !stats && !fragm_ip && !interfaces;
+	return !bytes && !cfg && !stats && !fragm_ip && !pkt_stats && !interfaces;
 }
 
 
@@ -476,6 +480,9 @@ void Domain::report(Generator &g, Report const &report_cfg) const
 	if (report_cfg.dropped_fragm_ipv4() && _dropped_fragm_ipv4)
 		g.node("dropped-fragm-ipv4", [&] () {
 			g.attribute("value", _dropped_fragm_ipv4); });
+	if (report_cfg.packet_stats() && !_packet_stats.report_empty())
+		g.node("packet-stats", [&] {
+			_packet_stats.report(g, report_cfg.top_flows()); });
 	_interfaces.for_each([&] (Interface const &interface) {
 		if (!interface.report_empty(report_cfg))
 			g.node("interface", [&] { interface.report(g, report_cfg); });
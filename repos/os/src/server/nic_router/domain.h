@@ -107,7 +107,7 @@ class Net::Domain : public List<Domain>::Element,
 		Genode::Reconstructible<Ipv4_config>  _ip_config;
 		bool                            const _ip_config_dynamic    { !ip_config().valid() };
 		List<Domain>                          _ip_config_dependents { };
-		Arp_cache                             _arp_cache            { *this };
+		Arp_cache                             _arp_cache;
 		Arp_waiter_list                       _foreign_arp_waiters  { };
 		Link_side_tree                        _tcp_links            { };
 		Link_side_tree                        _udp_links            { };
@@ -126,6 +126,7 @@ class Net::Domain : public List<Domain>::Element,
 		Domain_object_stats                   _arp_stats            { };
 		Domain_object_stats                   _dhcp_stats           { };
 		unsigned long                         _dropped_fragm_ipv4   { 0 };
+		Packet_stats                          _packet_stats         { };
 
 		[[nodiscard]] bool _read_forward_rules(Genode::Cstring  const &protocol,
 		                                       Domain_dict            &domains,
@@ -272,6 +273,7 @@ class Net::Domain : public List<Domain>::Element,
 		Domain_link_stats           &icmp_stats()                { return _icmp_stats; }
 		Domain_object_stats         &arp_stats()                 { return _arp_stats; }
 		Domain_object_stats         &dhcp_stats()                { return _dhcp_stats; }
+		Packet_stats                &packet_stats()              { return _packet_stats; }
 		bool                         ip_config_dynamic() const   { return _ip_config_dynamic; };
 };
 
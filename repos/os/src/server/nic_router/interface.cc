@@ -18,6 +18,7 @@
 #include <net/arp.h>
 #include <net/internet_checksum.h>
 #include <base/quota_guard.h>
+#include <trace/timestamp.h>
 
 /* local includes */
 #include <interface.h>
@@ -30,6 +31,7 @@ using namespace Net;
 using Genode::Deallocator;
 using Genode::size_t;
 using Genode::uint32_t;
+using Genode::uint64_t;
 using Genode::addr_t;
 using Genode::log;
 using Genode::error;
@@ -40,6 +42,8 @@ using Genode::Constructible;
 using Genode::Reconstructible;
 using Genode::Signal_context_capability;
 using Genode::Signal_transmitter;
+using Genode::Microseconds;
+using Genode::Duration;
 using Dhcp_options = Dhcp_packet::Options_aggregator<Size_guard>;
 
 
@@ -162,27 +166,31 @@ static void _link_packet(L3_protocol  const  prot,
 }
 
 
-static void _update_checksum(L3_protocol   const prot,
-                             void         *const prot_base,
-                             size_t        const prot_size,
-                             Ipv4_address  const src,
-                             Ipv4_address  const dst,
-                             size_t        const ip_size)
+/**
+ * Update checksum of transport packet according to the modified header fields
+ *
+ * The update is incremental, so the costs don't depend on the packet size and
+ * a checksum that was incorrect before stays incorrect. The TCP and UDP
+ * checksums cover the IP addresses via the pseudo header.
+ */
+static void _update_checksum(L3_protocol            const  prot,
+                             void                  *const  prot_base,
+                             Internet_checksum_diff const &ip_icd,
+                             Internet_checksum_diff const &prot_icd)
 {
+	Internet_checksum_diff icd { prot_icd };
 	switch (prot) {
 	case L3_protocol::TCP:
-		((Tcp_packet *)prot_base)->update_checksum(src, dst, prot_size);
+		icd.add_up_diff(ip_icd);
+		((Tcp_packet *)prot_base)->update_checksum(icd);
 		return;
 	case L3_protocol::UDP:
-		((Udp_packet *)prot_base)->update_checksum(src, dst);
+		icd.add_up_diff(ip_icd);
+		((Udp_packet *)prot_base)->update_checksum(icd);
 		return;
 	case L3_protocol::ICMP:
-		{
-			Icmp_packet &icmp = *(Icmp_packet *)prot_base;
-			icmp.update_checksum(ip_size - sizeof(Ipv4_packet) -
-			                               sizeof(Icmp_packet));
-			return;
-		}
+		((Icmp_packet *)prot_base)->update_checksum(icd);
+		return;
 	default: ASSERT_NEVER_REACHED; }
 }
 
@@ -209,6 +217,19 @@ static void _dst_port(L3_protocol  const prot,
 }
 
 
+static void _dst_port(L3_protocol             const  prot,
+                      void                   *const  prot_base,
+                      Port                    const  port,
+                      Internet_checksum_diff        &prot_icd)
+{
+	switch (prot) {
+	case L3_protocol::TCP:  (*(Tcp_packet *)prot_base).dst_port(port, prot_icd);  return;
+	case L3_protocol::UDP:  (*(Udp_packet *)prot_base).dst_port(port, prot_icd);  return;
+	case L3_protocol::ICMP: (*(Icmp_packet *)prot_base).query_id(port.value, prot_icd); return;
+	default: ASSERT_NEVER_REACHED; }
+}
+
+
 static Port _src_port(L3_protocol const prot, void *const prot_base)
 {
 	switch (prot) {
@@ -231,6 +252,19 @@ static void _src_port(L3_protocol  const prot,
 }
 
 
+static void _src_port(L3_protocol             const  prot,
+                      void                   *const  prot_base,
+                      Port                    const  port,
+                      Internet_checksum_diff        &prot_icd)
+{
+	switch (prot) {
+	case L3_protocol::TCP:  ((Tcp_packet *)prot_base)->src_port(port, prot_icd);        return;
+	case L3_protocol::UDP:  ((Udp_packet *)prot_base)->src_port(port, prot_icd);        return;
+	case L3_protocol::ICMP: ((Icmp_packet *)prot_base)->query_id(port.value, prot_icd); return;
+	default: ASSERT_NEVER_REACHED; }
+}
+
+
 static void *_prot_base(L3_protocol const  prot,
                         Size_guard        &size_guard,
                         Ipv4_packet       &ip)
@@ -334,11 +368,9 @@ void Interface::_pass_prot_to_domain(Domain                       &domain,
                                      Internet_checksum_diff const &ip_icd,
                                      L3_protocol            const  prot,
                                      void                  *const  prot_base,
-                                     size_t                 const  prot_size)
+                                     Internet_checksum_diff const &prot_icd)
 {
-	_update_checksum(
-		prot, prot_base, prot_size, ip.src(), ip.dst(), ip.total_length());
-
+	_update_checksum(prot, prot_base, ip_icd, prot_icd);
 	ip.update_checksum(ip_icd);
 	domain.interfaces().for_each([&] (Interface &interface)
 	{
@@ -458,8 +490,8 @@ void Interface::detach_from_ip_config(Domain &domain)
 	_destroy_links<Udp_link> (_udp_links,  _dissolved_udp_links,  _alloc);
 	_destroy_links<Icmp_link>(_icmp_links, _dissolved_icmp_links, _alloc);
 
-	/* destroy DHCP allocations */
-	_destroy_released_dhcp_allocations(domain);
+	/* drop DHCP requests that were not handled yet and destroy DHCP allocations */
+	_drop_dhcp_requests();
 	while (Dhcp_allocation *allocation = _dhcp_allocations.first()) {
 		_dhcp_allocations.remove(*allocation);
 		_destroy_dhcp_allocation(*allocation, domain);
@@ -558,8 +590,9 @@ Packet_result Interface::_new_link(L3_protocol          const  protocol,
 
 void Interface::dhcp_allocation_expired(Dhcp_allocation &allocation)
 {
+	/* the lease wheel has already let go of the allocation */
 	_release_dhcp_allocation(allocation, *_domain_ptr);
-	_released_dhcp_allocations.insert(&allocation);
+	_destroy_dhcp_allocation(allocation, *_domain_ptr);
 }
 
 
@@ -583,6 +616,24 @@ Link_list &Interface::dissolved_links(L3_protocol const protocol)
 }
 
 
+Packet_result Interface::_adapt_eth(Ethernet_frame          &eth,
+                                    Link_side               &remote_side,
+                                    Packet_descriptor const &pkt)
+{
+	Domain &remote_domain = remote_side.domain();
+	if (remote_domain.use_arp() && remote_domain.ip_config().valid() &&
+	    remote_side.with_next_hop_mac(remote_domain.arp_cache().generation(),
+	                                  [&] (Mac_address const &mac) { eth.dst(mac); }))
+		return { };
+
+	Packet_result result { _adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain) };
+	if (!result.valid() && remote_domain.use_arp())
+		remote_side.next_hop_mac(eth.dst(), remote_domain.arp_cache().generation());
+
+	return result;
+}
+
+
 Packet_result Interface::_adapt_eth(Ethernet_frame          &eth,
                                     Ipv4_address      const &dst_ip,
                                     Packet_descriptor const &pkt,
@@ -650,7 +701,7 @@ Packet_result Interface::_nat_link_and_pass(Ethernet_frame         &eth,
                                             Internet_checksum_diff &ip_icd,
                                             L3_protocol      const  prot,
                                             void            *const  prot_base,
-                                            size_t           const  prot_size,
+                                            Internet_checksum_diff &prot_icd,
                                             Link_side_id     const &local_id,
                                             Domain                 &local_domain,
                                             Domain                 &remote_domain)
@@ -667,7 +718,7 @@ Packet_result Interface::_nat_link_and_pass(Ethernet_frame         &eth,
 			Port src_port(0);
 			nat.port_alloc(prot).alloc().with_result(
 				[&] (Port src_port) {
-					_src_port(prot, prot_base, src_port);
+					_src_port(prot, prot_base, src_port, prot_icd);
 					ip.src(remote_domain.ip_config().interface().address, ip_icd);
 					remote_port_alloc_ptr = &nat.port_alloc(prot); },
 				[&] (auto) {
@@ -689,7 +740,7 @@ Packet_result Interface::_nat_link_and_pass(Ethernet_frame         &eth,
 	if (result.valid())
 		return result;
 
-	_pass_prot_to_domain(remote_domain, eth, size_guard, ip, ip_icd, prot, prot_base, prot_size);
+	_pass_prot_to_domain(remote_domain, eth, size_guard, ip, ip_icd, prot, prot_base, prot_icd);
 	return packet_handled();
 }
 
@@ -803,7 +854,7 @@ Packet_result Interface::_new_dhcp_allocation(Ethernet_frame &eth,
 				[&] {
 					Dhcp_allocation &allocation = *new (_alloc)
 						Dhcp_allocation { *this, ip, dhcp.client_mac(),
-						                  _timer, _config_ptr->dhcp_offer_timeout() };
+						                  _dhcp_lease_wheel, _config_ptr->dhcp_offer_timeout() };
 
 					_dhcp_allocations.insert(allocation);
 					if (_config_ptr->verbose()) {
@@ -1080,10 +1131,10 @@ Packet_result Interface::_handle_icmp_query(Ethernet_frame          &eth,
                                             Packet_descriptor const &pkt,
                                             L3_protocol              prot,
                                             void                    *prot_base,
-                                            size_t                   prot_size,
                                             Domain                  &local_domain)
 {
 	Packet_result result { };
+	Internet_checksum_diff prot_icd { };
 	Link_side_id const local_id = { ip.src(), _src_port(prot, prot_base),
 	                                ip.dst(), _dst_port(prot, prot_base) };
 
@@ -1100,16 +1151,16 @@ Packet_result Interface::_handle_icmp_query(Ethernet_frame          &eth,
 				log("[", local_domain, "] using ", l3_protocol_name(prot),
 				    " link: ", link);
 			}
-			result = _adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
+			result = _adapt_eth(eth, remote_side, pkt);
 			if (result.valid())
 				return;
 			ip.src(remote_side.dst_ip(), ip_icd);
 			ip.dst(remote_side.src_ip(), ip_icd);
-			_src_port(prot, prot_base, remote_side.dst_port());
-			_dst_port(prot, prot_base, remote_side.src_port());
+			_src_port(prot, prot_base, remote_side.dst_port(), prot_icd);
+			_dst_port(prot, prot_base, remote_side.src_port(), prot_icd);
 			_pass_prot_to_domain(
 				remote_domain, eth, size_guard, ip, ip_icd, prot,
-				prot_base, prot_size);
+				prot_base, prot_icd);
 
 			_link_packet(prot, prot_base, link, client);
 			result = packet_handled();
@@ -1132,7 +1183,7 @@ Packet_result Interface::_handle_icmp_query(Ethernet_frame          &eth,
 			if (result.valid())
 				return;
 			result = _nat_link_and_pass(
-				eth, size_guard, ip, ip_icd, prot, prot_base, prot_size, local_id, local_domain, remote_domain);
+				eth, size_guard, ip, ip_icd, prot, prot_base, prot_icd, local_id, local_domain, remote_domain);
 		},
 		[&] /* handle_no_match */ () { }
 	);
@@ -1179,7 +1230,7 @@ Packet_result Interface::_handle_icmp_error(Ethernet_frame          &eth,
 				    l3_protocol_name(embed_prot), " link: ", link);
 			}
 			/* adapt source and destination of Ethernet frame and IP packet */
-			result = _adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
+			result = _adapt_eth(eth, remote_side, pkt);
 			if (result.valid())
 				return;
 			if (remote_side.dst_ip() == remote_domain.ip_config().interface().address) {
@@ -1247,7 +1298,7 @@ Packet_result Interface::_handle_icmp(Ethernet_frame            &eth,
 	/* try to act as ICMP router */
 	switch (icmp.type()) {
 	case Icmp_packet::Type::ECHO_REPLY:
-	case Icmp_packet::Type::ECHO_REQUEST: result = _handle_icmp_query(eth, size_guard, ip, ip_icd, pkt, prot, prot_base, prot_size, local_domain); break;
+	case Icmp_packet::Type::ECHO_REQUEST: result = _handle_icmp_query(eth, size_guard, ip, ip_icd, pkt, prot, prot_base, local_domain); break;
 	case Icmp_packet::Type::DST_UNREACHABLE: result = _handle_icmp_error(eth, size_guard, ip, ip_icd, pkt, local_domain, icmp, prot_size); break;
 	default: result = packet_drop("unhandled type in ICMP"); }
 	return result;
@@ -1307,7 +1358,10 @@ Packet_result Interface::_handle_ip(Ethernet_frame          &eth,
 
 					local_domain.with_dhcp_server(
 						[&] /* dhcp_server_fn */ (Dhcp_server &srv) {
-							result = _handle_dhcp_request(eth, srv, dhcp, local_domain, local_intf); },
+							if (_handling_dhcp_requests)
+								result = _handle_dhcp_request(eth, srv, dhcp, local_domain, local_intf);
+							else
+								result = _queue_dhcp_request(pkt); },
 						[&] /* no_dhcp_server_fn */ {
 							result = packet_drop("DHCP request while DHCP server inactive"); });
 					return result;
@@ -1336,9 +1390,15 @@ Packet_result Interface::_handle_ip(Ethernet_frame          &eth,
 			                      prot_size, local_domain, local_intf);
 		} else {
 
+			Internet_checksum_diff prot_icd { };
 			Link_side_id const local_id = { ip.src(), _src_port(prot, prot_base),
 			                                ip.dst(), _dst_port(prot, prot_base) };
 
+			if (_config_ptr->packet_stats())
+				local_domain.packet_stats().flows.add(
+					prot, local_id.src_ip, local_id.src_port, local_id.dst_ip,
+					local_id.dst_port, size_guard.total_size());
+
 			/* try to route via existing UDP/TCP links */
 			local_domain.links(prot).find_by_id(
 				local_id,
@@ -1354,16 +1414,16 @@ Packet_result Interface::_handle_ip(Ethernet_frame          &eth,
 						log("[", local_domain, "] using ", l3_protocol_name(prot),
 						    " link: ", link);
 					}
-					result = _adapt_eth(eth, remote_side.src_ip(), pkt, remote_domain);
+					result = _adapt_eth(eth, remote_side, pkt);
 					if (result.valid())
 						return;
 					ip.src(remote_side.dst_ip(), ip_icd);
 					ip.dst(remote_side.src_ip(), ip_icd);
-					_src_port(prot, prot_base, remote_side.dst_port());
-					_dst_port(prot, prot_base, remote_side.src_port());
+					_src_port(prot, prot_base, remote_side.dst_port(), prot_icd);
+					_dst_port(prot, prot_base, remote_side.src_port(), prot_icd);
 					_pass_prot_to_domain(
 						remote_domain, eth, size_guard, ip, ip_icd, prot,
-						prot_base, prot_size);
+						prot_base, prot_icd);
 
 					_link_packet(prot, prot_base, link, client);
 					result = packet_handled();
@@ -1386,11 +1446,11 @@ Packet_result Interface::_handle_ip(Ethernet_frame          &eth,
 						return;
 					ip.dst(rule.to_ip(), ip_icd);
 					if (!(rule.to_port() == Port(0))) {
-						_dst_port(prot, prot_base, rule.to_port());
+						_dst_port(prot, prot_base, rule.to_port(), prot_icd);
 					}
 					result = _nat_link_and_pass(
 						eth, size_guard, ip, ip_icd, prot, prot_base,
-						prot_size, local_id, local_domain, remote_domain);
+						prot_icd, local_id, local_domain, remote_domain);
 				});
 				if (result.valid())
 					return result;
@@ -1408,7 +1468,7 @@ Packet_result Interface::_handle_ip(Ethernet_frame          &eth,
 					if (result.valid())
 						return;
 					result = _nat_link_and_pass(
-						eth, size_guard, ip, ip_icd, prot, prot_base, prot_size,
+						eth, size_guard, ip, ip_icd, prot, prot_base, prot_icd,
 						local_id, local_domain, remote_domain);
 				});
 		}
@@ -1495,6 +1555,9 @@ void Interface::_handle_arp_reply(Ethernet_frame &eth,
 			/* check wether a matching ARP cache entry already exists */
 			if (_config_ptr->verbose()) {
 				log("[", local_domain, "] ARP entry already exists"); }
+
+			/* the peer may have changed its MAC address meanwhile */
+			local_domain.arp_cache().refresh_entry(arp.src_ip(), arp.src_mac());
 		},
 		[&] /* handle_no_match */ ()
 		{
@@ -1509,6 +1572,9 @@ void Interface::_handle_arp_reply(Ethernet_frame &eth,
 				Arp_waiter &waiter = *waiter_le->object();
 				waiter_le = waiter_le->next();
 				if (ip != waiter.ip()) { continue; }
+				if (_config_ptr->packet_stats())
+					local_domain.packet_stats().arp_wait_us.add(
+						_timer.cached_time().trunc_to_plain_us().value - waiter.created_us());
 				waiter.flush_packets(waiter.src()._alloc, [&] (Packet_descriptor const &packet) {
 					waiter.src()._continue_handle_eth(packet); });
 				destroy(waiter.src()._alloc, &waiter);
@@ -1571,7 +1637,11 @@ Packet_result Interface::_handle_arp_request(Ethernet_frame &eth,
 		/* ARP request for an IP local to the domain's subnet */
 		if (arp.src_ip() == arp.dst_ip()) {
 
-			/* gratuitous ARP requests are not really necessary */
+			/*
+			 * Gratuitous ARP requests are not answered but may announce a
+			 * new MAC address for an IP address that we already know
+			 */
+			local_domain.arp_cache().refresh_entry(arp.src_ip(), arp.src_mac());
 			return packet_drop("gratuitous ARP request");
 
 		} else if (arp.dst_ip() == local_intf.address) {
@@ -1634,6 +1704,9 @@ void Interface::_drop_packet(Packet_descriptor const &pkt, char const *reason)
 	_ack_packet(pkt);
 	with_domain(
 		[&] /* domain_fn */ (Domain &domain) {
+			if (_config_ptr->packet_stats())
+				domain.packet_stats().drops.add(reason);
+
 			if (domain .verbose_packet_drop())
 				log("[", domain, "] drop packet (", reason, ")"); },
 		[&] /* no_domain_fn */ {
@@ -1644,6 +1717,9 @@ void Interface::_drop_packet(Packet_descriptor const &pkt, char const *reason)
 
 void Interface::_handle_pkt()
 {
+	bool const packet_stats = _config_ptr->packet_stats();
+	Genode::Trace::Timestamp const start = packet_stats ? Genode::Trace::timestamp() : 0;
+
 	Packet_descriptor const pkt = _sink.get_packet();
 	if (!_sink.packet_valid(pkt) || pkt.size() < sizeof(Packet_stream_sink::Content_type)) {
 		_drop_packet(pkt, "invalid Nic packet");
@@ -1651,6 +1727,12 @@ void Interface::_handle_pkt()
 	}
 	Size_guard size_guard(pkt.size());
 	Packet_result result = _handle_eth(_sink.packet_content(pkt), size_guard, pkt);
+
+	/* account the time from receiving the packet until it was passed on */
+	if (packet_stats && result.type == Packet_result::HANDLED)
+		with_domain([&] (Domain &domain) {
+			domain.packet_stats().processing_cycles.add(Genode::Trace::timestamp() - start); });
+
 	switch (result.type) {
 	case Packet_result::HANDLED: _ack_packet(pkt); break;
 	case Packet_result::POSTPONED: break;
@@ -1698,6 +1780,12 @@ void Interface::_handle_pkt_stream_signal()
 			_handle_pkt();
 		}
 	}
+	/*
+	 * Handle DHCP requests only after all other packets of this signal in
+	 * order to not delay forwarding during bursts of DHCP requests.
+	 */
+	if (!_dhcp_requests.empty())
+		_handle_dhcp_requests();
 
 	/*
 	 * Since we use the try_*() variants of the packet-stream API, we
@@ -1734,6 +1822,49 @@ void Interface::_continue_handle_eth(Packet_descriptor const &pkt)
 }
 
 
+Packet_result Interface::_queue_dhcp_request(Packet_descriptor const &pkt)
+{
+	if (_dhcp_requests.full())
+		return packet_drop("DHCP request queue full");
+
+	_dhcp_requests.enqueue(pkt);
+	return packet_postponed();
+}
+
+
+void Interface::_handle_dhcp_requests()
+{
+	uint64_t const rate    = _config_ptr->dhcp_requests_per_sec();
+	uint64_t const curr_us = _timer.cached_time().trunc_to_plain_us().value;
+
+	_handling_dhcp_requests = true;
+	_dhcp_requests.dequeue_ready(rate, curr_us, [&] (Packet_descriptor const &pkt) {
+		_continue_handle_eth(pkt); });
+	_handling_dhcp_requests = false;
+
+	if (!_dhcp_requests.empty())
+		_dhcp_requests_timeout.schedule(
+			Microseconds { Genode::max(_dhcp_requests.us_until_ready(rate, curr_us), (uint64_t)1) });
+}
+
+
+void Interface::_handle_dhcp_requests_timeout(Duration curr_time)
+{
+	_timer.cached_time(curr_time);
+	_handle_dhcp_requests();
+	wakeup_source();
+	wakeup_sink();
+}
+
+
+void Interface::_drop_dhcp_requests()
+{
+	_dhcp_requests_timeout.discard();
+	_dhcp_requests.dequeue_all([&] (Packet_descriptor const &pkt) {
+		_drop_packet(pkt, "DHCP request queue dissolved"); });
+}
+
+
 void Interface::_destroy_dhcp_allocation(Dhcp_allocation &allocation,
                                          Domain          &local_domain)
 {
@@ -1743,15 +1874,6 @@ void Interface::_destroy_dhcp_allocation(Dhcp_allocation &allocation,
 }
 
 
-void Interface::_destroy_released_dhcp_allocations(Domain &local_domain)
-{
-	while (Dhcp_allocation *allocation = _released_dhcp_allocations.first()) {
-		_released_dhcp_allocations.remove(allocation);
-		_destroy_dhcp_allocation(*allocation, local_domain);
-	}
-}
-
-
 void Interface::_destroy_timed_out_arp_waiters()
 {
 	while (Arp_waiter_list_element *le = _timed_out_arp_waiters.first()) {
@@ -1831,23 +1953,29 @@ Packet_result Interface::_handle_eth(void              *const  eth_base,
 		Ethernet_frame &eth = Ethernet_frame::cast_from(eth_base, size_guard);
 		auto domain_fn = [&] (Domain &domain) {
 
-			domain.raise_rx_bytes(size_guard.total_size());
+			/*
+			 * A queued DHCP request was already accounted, logged, and
+			 * traced when it was received
+			 */
+			if (!_handling_dhcp_requests) {
+
+				domain.raise_rx_bytes(size_guard.total_size());
+
+				/* log received packet if desired */
+				if (domain.verbose_packets()) {
+					log("[", domain, "] rcv ", eth); }
 
-			/* do garbage collection over transport-layer links and DHCP allocations */
+				if (domain.trace_packets())
+					Genode::Trace::Ethernet_packet(
+						domain.name().string(), Genode::Trace::Ethernet_packet::Direction::RECV,
+							eth_base, size_guard.total_size());
+			}
+
+			/* do garbage collection over transport-layer links and ARP waiters */
 			_destroy_dissolved_links<Icmp_link>(_dissolved_icmp_links, _alloc);
 			_destroy_dissolved_links<Udp_link>(_dissolved_udp_links, _alloc);
 			_destroy_dissolved_links<Tcp_link>(_dissolved_tcp_links, _alloc);
 			_destroy_timed_out_arp_waiters();
-			_destroy_released_dhcp_allocations(domain);
-
-			/* log received packet if desired */
-			if (domain.verbose_packets()) {
-				log("[", domain, "] rcv ", eth); }
-
-			if (domain.trace_packets())
-				Genode::Trace::Ethernet_packet(
-					domain.name().string(), Genode::Trace::Ethernet_packet::Direction::RECV,
-						eth_base, size_guard.total_size());
 
 			result = _handle_eth(eth, size_guard, pkt, domain);
 		};
@@ -1917,7 +2045,9 @@ Interface::Interface(Genode::Entrypoint     &ep,
 	_policy                    { policy },
 	_timer                     { timer },
 	_alloc                     { alloc },
-	_interfaces                { interfaces }
+	_interfaces                { interfaces },
+	_dhcp_lease_wheel          { timer, Microseconds { DHCP_LEASE_WHEEL_TICK_US } },
+	_dhcp_requests_timeout     { timer, *this, &Interface::_handle_dhcp_requests_timeout }
 {
 	_interfaces.insert(this);
 	_config_ptr->with_report([&] (Report &r) { r.handle_interface_link_state(); });
@@ -2132,7 +2262,6 @@ void Interface::handle_config_1(Configuration &config)
 		_destroy_dissolved_links<Udp_link> (_dissolved_udp_links,  _alloc);
 		_destroy_dissolved_links<Tcp_link> (_dissolved_tcp_links,  _alloc);
 		_destroy_timed_out_arp_waiters();
-		_destroy_released_dhcp_allocations(old_domain);
 
 		/* do not consider to reuse IP config if the domains differ */
 		if (old_domain.name() != new_domain_name) {
@@ -20,6 +20,8 @@
 #include <l3_protocol.h>
 #include <dhcp_client.h>
 #include <dhcp_server.h>
+#include <dhcp_request_queue.h>
+#include <timeout_wheel.h>
 #include <list.h>
 #include <report.h>
 
@@ -129,6 +131,7 @@ class Net::Interface : private Interface_list::Element
 
 		enum { IPV4_TIME_TO_LIVE          = 64 };
 		enum { MAX_FREE_OPS_PER_EMERGENCY = 100 };
+		enum { DHCP_LEASE_WHEEL_TICK_US   = 1000 * 1000 };
 
 		struct Update_domain
 		{
@@ -162,9 +165,12 @@ class Net::Interface : private Interface_list::Element
 		Link_list                             _dissolved_udp_links       { };
 		Link_list                             _dissolved_icmp_links      { };
 		Dhcp_allocation_tree                  _dhcp_allocations          { };
-		Dhcp_allocation_list                  _released_dhcp_allocations { };
 		Genode::Constructible<Dhcp_client>    _dhcp_client               { };
 		Interface_list                       &_interfaces;
+		Timeout_wheel                         _dhcp_lease_wheel;
+		Dhcp_request_queue                    _dhcp_requests             { };
+		bool                                  _handling_dhcp_requests    { false };
+		Timer::One_shot_timeout<Interface>    _dhcp_requests_timeout;
 		Genode::Constructible<Update_domain>  _update_domain             { };
 		Interface_link_stats                  _udp_stats                 { };
 		Interface_link_stats                  _tcp_stats                 { };
@@ -187,8 +193,6 @@ class Net::Interface : private Interface_list::Element
 		                                     Domain                     &remote_domain,
 		                                     Link_side_id         const &remote_id);
 
-		void _destroy_released_dhcp_allocations(Domain &local_domain);
-
 		void _destroy_dhcp_allocation(Dhcp_allocation &allocation,
 		                              Domain          &local_domain);
 
@@ -253,7 +257,6 @@ class Net::Interface : private Interface_list::Element
 		                                Packet_descriptor const &pkt,
 		                                L3_protocol              prot,
 		                                void                    *prot_base,
-		                                Genode::size_t           prot_size,
 		                                Domain                  &local_domain);
 
 		[[nodiscard]] Packet_result _handle_icmp_error(Ethernet_frame          &eth,
@@ -281,13 +284,23 @@ class Net::Interface : private Interface_list::Element
 		                                      Packet_descriptor const &pkt,
 		                                      Domain                  &remote_domain);
 
+		/**
+		 * Adapt Ethernet frame towards the remote side of a link
+		 *
+		 * Caches the MAC address of the next hop at the link side so that
+		 * successive packets of the link skip the ARP-cache lookup.
+		 */
+		[[nodiscard]] Packet_result _adapt_eth(Ethernet_frame          &eth,
+		                                      Link_side               &remote_side,
+		                                      Packet_descriptor const &pkt);
+
 		[[nodiscard]] Packet_result _nat_link_and_pass(Ethernet_frame         &eth,
 		                                              Size_guard             &size_guard,
 		                                              Ipv4_packet            &ip,
 		                                              Internet_checksum_diff &ip_icd,
 		                                              L3_protocol      const  prot,
 		                                              void            *const  prot_base,
-		                                              Genode::size_t   const  prot_size,
+		                                              Internet_checksum_diff &prot_icd,
 		                                              Link_side_id     const &local_id,
 		                                              Domain                 &local_domain,
 		                                              Domain                 &remote_domain);
@@ -306,7 +319,7 @@ class Net::Interface : private Interface_list::Element
 		                          Internet_checksum_diff const &ip_icd,
 		                          L3_protocol            const  prot,
 		                          void                  *const  prot_base,
-		                          Genode::size_t         const  prot_size);
+		                          Internet_checksum_diff const &prot_icd);
 
 		void _handle_pkt();
 
@@ -327,6 +340,14 @@ class Net::Interface : private Interface_list::Element
 
 		void _ack_packet(Packet_descriptor const &pkt);
 
+		[[nodiscard]] Packet_result _queue_dhcp_request(Packet_descriptor const &pkt);
+
+		void _handle_dhcp_requests();
+
+		void _handle_dhcp_requests_timeout(Genode::Duration);
+
+		void _drop_dhcp_requests();
+
 		void _send_submit_pkt(Genode::Packet_descriptor   &pkt,
 		                      void                      * &pkt_base,
 		                      Genode::size_t               pkt_size);
@@ -35,6 +35,7 @@
 #include <util/list.h>
 #include <net/ipv4.h>
 #include <net/port.h>
+#include <net/ethernet.h>
 
 /* local includes */
 #include <list.h>
@@ -91,6 +92,8 @@ class Net::Link_side : public Genode::Avl_node<Link_side>
 		Domain             *_domain_ptr;
 		Link_side_id const  _id;
 		Link               &_link;
+		Mac_address         _next_hop_mac        { };
+		unsigned long       _next_hop_generation { 0 };
 
 		/*
 		 * Noncopyable
@@ -129,6 +132,29 @@ class Net::Link_side : public Genode::Avl_node<Link_side>
 
 		bool is_client() const;
 
+		/**
+		 * Call 'fn' with the cached MAC address of the next hop towards this side
+		 *
+		 * \param generation  current generation of the ARP cache of the domain
+		 *
+		 * \return  false if no MAC address was cached since the last change
+		 *          of the ARP cache
+		 */
+		bool with_next_hop_mac(unsigned long generation, auto const &fn) const
+		{
+			if (generation != _next_hop_generation)
+				return false;
+
+			fn(_next_hop_mac);
+			return true;
+		}
+
+		void next_hop_mac(Mac_address const &mac, unsigned long generation)
+		{
+			_next_hop_mac        = mac;
+			_next_hop_generation = generation;
+		}
+
 
 		/**************
 		 ** Avl_node **
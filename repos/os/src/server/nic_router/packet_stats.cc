@@ -0,0 +1,211 @@
+/*
+ * \brief  Fixed-size packet statistics of a domain
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include <packet_stats.h>
+
+/* Genode includes */
+#include <base/node.h>
+#include <util/string.h>
+
+using namespace Net;
+using namespace Genode;
+
+
+/********************
+ ** Log2_histogram **
+ ********************/
+
+bool Log2_histogram::report_empty() const
+{
+	for (uint64_t value : _buckets)
+		if (value)
+			return false;
+
+	return true;
+}
+
+
+void Log2_histogram::report(Generator &g) const
+{
+	for (unsigned i = 0; i < NUM_BUCKETS; i++) {
+		if (!_buckets[i])
+			continue;
+
+		g.node("bucket", [&] {
+			if (i < NUM_BUCKETS - 1)
+				g.attribute("below", 1ULL << i);
+			g.attribute("value", _buckets[i]);
+		});
+	}
+}
+
+
+/****************
+ ** Drop_stats **
+ ****************/
+
+void Drop_stats::add(char const *reason)
+{
+	for (unsigned i = 0; i < _count; i++) {
+		Entry &entry = _entries[i];
+		if (entry.reason == reason || !strcmp(entry.reason, reason)) {
+			entry.value++;
+			return;
+		}
+	}
+	if (_count < MAX_REASONS) {
+		_entries[_count++] = { reason, 1 };
+		return;
+	}
+	_other++;
+}
+
+
+void Drop_stats::report(Generator &g) const
+{
+	for (unsigned i = 0; i < _count; i++)
+		g.node("drop", [&] {
+			g.attribute("reason", _entries[i].reason);
+			g.attribute("value",  _entries[i].value);
+		});
+
+	if (_other)
+		g.node("drop", [&] {
+			g.attribute("reason", "other");
+			g.attribute("value",  _other);
+		});
+}
+
+
+/****************
+ ** Flow_stats **
+ ****************/
+
+bool Flow_stats::Flow::matches(L3_protocol         prot,
+                               Ipv4_address const &src_ip,
+                               Port                src_port,
+                               Ipv4_address const &dst_ip,
+                               Port                dst_port) const
+{
+	return this->prot     == prot     &&
+	       this->src_port == src_port &&
+	       this->dst_port == dst_port &&
+	       this->src_ip   == src_ip   &&
+	       this->dst_ip   == dst_ip;
+}
+
+
+void Flow_stats::add(L3_protocol         prot,
+                     Ipv4_address const &src_ip,
+                     Port                src_port,
+                     Ipv4_address const &dst_ip,
+                     Port                dst_port,
+                     size_t              bytes)
+{
+	Flow *min_ptr = nullptr;
+	for (unsigned i = 0; i < _count; i++) {
+		Flow &flow = _flows[i];
+		if (flow.matches(prot, src_ip, src_port, dst_ip, dst_port)) {
+			flow.bytes += bytes;
+			flow.packets++;
+			return;
+		}
+		if (!min_ptr || flow.bytes < min_ptr->bytes)
+			min_ptr = &flow;
+	}
+	uint64_t error = 0;
+	if (_count < MAX_FLOWS)
+		min_ptr = &_flows[_count++];
+	else
+		error = min_ptr->bytes;
+
+	*min_ptr = { .prot     = prot,
+	             .src_ip   = src_ip,
+	             .src_port = src_port,
+	             .dst_ip   = dst_ip,
+	             .dst_port = dst_port,
+	             .bytes    = error + bytes,
+	             .packets  = 1,
+	             .error    = error };
+}
+
+
+void Flow_stats::report(Generator &g, unsigned max) const
+{
+	/* select the flows in descending order of bytes without sorting */
+	uint64_t prev_bytes = ~0ULL;
+	unsigned prev_idx   = 0;
+	for (unsigned reported = 0; reported < min(max, _count); reported++) {
+
+		Flow const *next_ptr = nullptr;
+		unsigned    next_idx = 0;
+		for (unsigned i = 0; i < _count; i++) {
+
+			Flow const &flow = _flows[i];
+			bool const after_prev =
+				flow.bytes < prev_bytes ||
+				(flow.bytes == prev_bytes && i > prev_idx);
+
+			if (reported && !after_prev)
+				continue;
+
+			if (!next_ptr || flow.bytes > next_ptr->bytes) {
+				next_ptr = &flow;
+				next_idx = i;
+			}
+		}
+		if (!next_ptr)
+			return;
+
+		Flow const &flow = *next_ptr;
+		g.node("flow", [&] {
+			g.attribute("protocol", l3_protocol_name(flow.prot));
+			g.attribute("src",      String<22>(flow.src_ip, ":", flow.src_port));
+			g.attribute("dst",      String<22>(flow.dst_ip, ":", flow.dst_port));
+			g.attribute("bytes",    flow.bytes);
+			g.attribute("packets",  flow.packets);
+			if (flow.error)
+				g.attribute("error", flow.error);
+		});
+		prev_bytes = flow.bytes;
+		prev_idx   = next_idx;
+	}
+}
+
+
+/******************
+ ** Packet_stats **
+ ******************/
+
+bool Packet_stats::report_empty() const
+{
+	return processing_cycles.report_empty() && arp_wait_us.report_empty() &&
+	       drops.report_empty() && flows.report_empty();
+}
+
+
+void Packet_stats::report(Generator &g, unsigned max_flows) const
+{
+	if (!processing_cycles.report_empty())
+		g.node("processing-cycles", [&] { processing_cycles.report(g); });
+
+	if (!arp_wait_us.report_empty())
+		g.node("arp-wait-us", [&] { arp_wait_us.report(g); });
+
+	if (!drops.report_empty())
+		g.node("drops", [&] { drops.report(g); });
+
+	if (!flows.report_empty() && max_flows)
+		g.node("flows", [&] { flows.report(g, max_flows); });
+}
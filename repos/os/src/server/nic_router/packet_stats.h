@@ -0,0 +1,157 @@
+/*
+ * \brief  Fixed-size packet statistics of a domain
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _PACKET_STATS_H_
+#define _PACKET_STATS_H_
+
+/* local includes */
+#include <l3_protocol.h>
+
+/* Genode includes */
+#include <net/port.h>
+
+namespace Genode { class Generator; }
+
+namespace Net {
+
+	class Log2_histogram;
+	class Drop_stats;
+	class Flow_stats;
+	class Packet_stats;
+}
+
+
+/**
+ * Histogram with power-of-two bucket bounds
+ *
+ * Bucket 0 counts the value 0, bucket i counts the values in
+ * [2^(i-1), 2^i). The last bucket also counts all greater values.
+ */
+class Net::Log2_histogram
+{
+	private:
+
+		static constexpr unsigned NUM_BUCKETS = 32;
+
+		Genode::uint64_t _buckets[NUM_BUCKETS] { };
+
+	public:
+
+		void add(Genode::uint64_t value)
+		{
+			unsigned const i = value ? (unsigned)Genode::log2(value) + 1 : 0;
+			_buckets[Genode::min(i, NUM_BUCKETS - 1)]++;
+		}
+
+		bool report_empty() const;
+		void report(Genode::Generator &) const;
+};
+
+
+/**
+ * Counters of dropped packets per drop reason
+ *
+ * Drop reasons are static strings (see 'packet_drop'). Once the table is
+ * full, drops of unknown reasons are accounted as "other".
+ */
+class Net::Drop_stats
+{
+	private:
+
+		static constexpr unsigned MAX_REASONS = 16;
+
+		struct Entry
+		{
+			char const     *reason;
+			Genode::size_t  value;
+		};
+
+		Entry          _entries[MAX_REASONS] { };
+		unsigned       _count { 0 };
+		Genode::size_t _other { 0 };
+
+	public:
+
+		void add(char const *reason);
+
+		bool report_empty() const { return !_count && !_other; }
+		void report(Genode::Generator &) const;
+};
+
+
+/**
+ * Flows with the most bytes received at a domain
+ *
+ * The table has a fixed number of slots. A new flow that finds no free slot
+ * replaces the flow with the fewest bytes and inherits its byte count
+ * ("space saving"). Hence, the byte count of a reported flow may be
+ * overestimated by at most the count of the flow it replaced, which is
+ * reported as 'error'. A flow that received more than 1/MAX_FLOWS of all
+ * accounted bytes is guaranteed to be in the table.
+ */
+class Net::Flow_stats
+{
+	public:
+
+		static constexpr unsigned MAX_FLOWS = 16;
+
+	private:
+
+		struct Flow
+		{
+			L3_protocol      prot     { };
+			Ipv4_address     src_ip   { };
+			Port             src_port { };
+			Ipv4_address     dst_ip   { };
+			Port             dst_port { };
+			Genode::uint64_t bytes    { 0 };
+			Genode::uint64_t packets  { 0 };
+			Genode::uint64_t error    { 0 };
+
+			bool matches(L3_protocol, Ipv4_address const &, Port,
+			             Ipv4_address const &, Port) const;
+		};
+
+		Flow     _flows[MAX_FLOWS] { };
+		unsigned _count { 0 };
+
+	public:
+
+		void add(L3_protocol         prot,
+		         Ipv4_address const &src_ip,
+		         Port                src_port,
+		         Ipv4_address const &dst_ip,
+		         Port                dst_port,
+		         Genode::size_t      bytes);
+
+		bool report_empty() const { return !_count; }
+
+		/**
+		 * Report the 'max' flows with the most bytes in descending order
+		 */
+		void report(Genode::Generator &, unsigned max) const;
+};
+
+
+struct Net::Packet_stats
+{
+	Log2_histogram processing_cycles { };
+	Log2_histogram arp_wait_us       { };
+	Drop_stats     drops             { };
+	Flow_stats     flows             { };
+
+	bool report_empty() const;
+	void report(Genode::Generator &, unsigned max_flows) const;
+};
+
+#endif /* _PACKET_STATS_H_ */
@@ -38,6 +38,9 @@ Net::Report::Report(bool                      const &verbose,
 	_link_state          { node.attribute_value("link_state", false) },
 	_link_state_triggers { node.attribute_value("link_state_triggers", false) },
 	_quota               { node.attribute_value("quota", true) },
+	_packet_stats        { node.attribute_value("packet_stats", false) },
+	_top_flows           { min(node.attribute_value("top_flows", 4U),
+	                           Flow_stats::MAX_FLOWS) },
 	_shared_quota        { shared_quota },
 	_pd                  { pd },
 	_reporter            { reporter },
@@ -16,6 +16,7 @@
 
 /* local includes */
 #include <cached_timer.h>
+#include <packet_stats.h>
 
 /* Genode */
 #include <os/reporter.h>
@@ -54,6 +55,8 @@ class Net::Report
 		bool                      const  _link_state;
 		bool                      const  _link_state_triggers;
 		bool                      const  _quota;
+		bool                      const  _packet_stats;
+		unsigned                  const  _top_flows;
 		Quota                     const &_shared_quota;
 		Genode::Pd_session              &_pd;
 		Genode::Reporter                &_reporter;
@@ -85,13 +88,15 @@ class Net::Report
 		 ** Accessors **
 		 ***************/
 
-		bool config()               const { return _config; }
-		bool bytes()                const { return _bytes; }
-		bool stats()                const { return _stats; }
-		bool quota()                const { return _quota; }
-		bool dropped_fragm_ipv4()   const { return _dropped_fragm_ipv4; }
-		bool link_state()           const { return _link_state; }
-		bool link_state_triggers()  const { return _link_state_triggers; }
+		bool     config()              const { return _config; }
+		bool     bytes()               const { return _bytes; }
+		bool     stats()               const { return _stats; }
+		bool     quota()               const { return _quota; }
+		bool     dropped_fragm_ipv4()  const { return _dropped_fragm_ipv4; }
+		bool     link_state()          const { return _link_state; }
+		bool     link_state_triggers() const { return _link_state_triggers; }
+		bool     packet_stats()        const { return _packet_stats; }
+		unsigned top_flows()           const { return _top_flows; }
 };
 
 #endif /* _REPORT_H_ */
@@ -23,6 +23,9 @@ SRC_CC += \
 	dns.cc \
 	dhcp_client.cc \
 	dhcp_server.cc \
+	dhcp_request_queue.cc \
+	timeout_wheel.cc \
+	packet_stats.cc \
 	report.cc \
 	node.cc \
 	uplink_session_root.cc \
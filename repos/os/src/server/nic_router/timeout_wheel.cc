@@ -0,0 +1,175 @@
+/*
+ * \brief  Timing wheel that serves many deadlines with one timeout
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include <timeout_wheel.h>
+
+using namespace Net;
+using namespace Genode;
+
+
+Timeout_wheel::Timeout_wheel(Cached_timer &timer, Microseconds tick)
+:
+	_timer     { timer },
+	_tick_us   { max(tick.value, (uint64_t)1) },
+	_curr_tick { _curr_us() / _tick_us },
+	_timeout   { timer, *this, &Timeout_wheel::_handle_timeout }
+{ }
+
+
+Timeout_wheel::~Timeout_wheel()
+{
+	for (Element *&slot : _slots)
+		while (slot)
+			_remove(*slot);
+}
+
+
+void Timeout_wheel::_insert(Element &elem)
+{
+	Element *&slot = _slot(elem._deadline_tick);
+	elem._wheel_ptr = this;
+	elem._prev      = nullptr;
+	elem._next      = slot;
+	if (slot)
+		slot->_prev = &elem;
+
+	slot = &elem;
+	_nr_of_elements++;
+}
+
+
+void Timeout_wheel::_remove(Element &elem)
+{
+	if (elem._prev)
+		elem._prev->_next = elem._next;
+	else
+		_slot(elem._deadline_tick) = elem._next;
+
+	if (elem._next)
+		elem._next->_prev = elem._prev;
+
+	elem._wheel_ptr = nullptr;
+	elem._prev      = nullptr;
+	elem._next      = nullptr;
+	_nr_of_elements--;
+}
+
+
+void Timeout_wheel::_expire_slot(uint64_t tick, uint64_t curr_tick,
+                                 Duration curr_time)
+{
+	/*
+	 * Restart at the head of the slot after each handler as the handler may
+	 * have removed other elements from the slot.
+	 */
+	for (;;) {
+		Element *elem = _slot(tick);
+		for (; elem && elem->_deadline_tick > curr_tick; elem = elem->_next);
+		if (!elem)
+			return;
+
+		_remove(*elem);
+		elem->_handle_fn(*elem, curr_time);
+	}
+}
+
+
+void Timeout_wheel::_schedule_timeout(uint64_t tick)
+{
+	if (tick >= _timeout_tick)
+		return;
+
+	_timeout_tick = tick;
+	uint64_t const deadline_us = tick * _tick_us;
+	uint64_t const curr_us     = _curr_us();
+	_timeout.schedule(Microseconds { deadline_us > curr_us ? deadline_us - curr_us : 1 });
+}
+
+
+void Timeout_wheel::_schedule_next_timeout()
+{
+	if (!_nr_of_elements) {
+		_timeout.discard();
+		_timeout_tick = NO_TICK;
+		return;
+	}
+	/*
+	 * The elements in the slot of a tick expire at that tick or in a later
+	 * rotation. Hence, the first slot that contains an element of the current
+	 * rotation determines the next timeout. If there is no such slot, the
+	 * scan has seen all elements and found the earliest deadline anyway.
+	 */
+	uint64_t next_tick = NO_TICK;
+	for (uint64_t tick = _curr_tick; tick < _curr_tick + NR_OF_SLOTS; tick++) {
+		for (Element *elem = _slot(tick); elem; elem = elem->_next)
+			next_tick = min(next_tick, elem->_deadline_tick);
+
+		if (next_tick <= tick)
+			break;
+	}
+	_schedule_timeout(next_tick);
+}
+
+
+void Timeout_wheel::_handle_timeout(Duration curr_time)
+{
+	_timer.cached_time(curr_time);
+	_timeout_tick = NO_TICK;
+
+	uint64_t const curr_tick = _curr_us() / _tick_us;
+	if (curr_tick >= _curr_tick) {
+
+		/* visit each slot at most once even if many ticks passed */
+		uint64_t const first_tick =
+			curr_tick - _curr_tick < NR_OF_SLOTS ?
+				_curr_tick : curr_tick - NR_OF_SLOTS + 1;
+
+		/* elements scheduled by the handlers expire not before the next tick */
+		_curr_tick = curr_tick + 1;
+		for (uint64_t tick = first_tick; tick <= curr_tick; tick++)
+			_expire_slot(tick, curr_tick, curr_time);
+	}
+	_schedule_next_timeout();
+}
+
+
+void Timeout_wheel::schedule(Element &elem, Microseconds duration)
+{
+	discard(elem);
+
+	uint64_t const curr_us = _curr_us();
+	if (!_nr_of_elements)
+		_curr_tick = max(_curr_tick, curr_us / _tick_us);
+
+	uint64_t const deadline_us =
+		duration.value <= NO_TICK - curr_us - _tick_us ?
+			curr_us + duration.value : NO_TICK - _tick_us;
+
+	elem._deadline_tick = max((deadline_us + _tick_us - 1) / _tick_us, _curr_tick);
+	_insert(elem);
+	_schedule_timeout(elem._deadline_tick);
+}
+
+
+void Timeout_wheel::discard(Element &elem)
+{
+	if (elem._wheel_ptr != this)
+		return;
+
+	_remove(elem);
+	if (!_nr_of_elements) {
+		_timeout.discard();
+		_timeout_tick = NO_TICK;
+	}
+}
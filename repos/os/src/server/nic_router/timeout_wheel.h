@@ -0,0 +1,166 @@
+/*
+ * \brief  Timing wheel that serves many deadlines with one timeout
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _TIMEOUT_WHEEL_H_
+#define _TIMEOUT_WHEEL_H_
+
+/* local includes */
+#include <cached_timer.h>
+
+namespace Net { class Timeout_wheel; }
+
+
+/**
+ * Hashed timing wheel with a fixed tick
+ *
+ * Deadlines are rounded up to the next tick and sorted into the slot of that
+ * tick, deadlines beyond one rotation of the wheel share the slot with earlier
+ * ones. The wheel uses a single timer timeout that is scheduled for the next
+ * tick with an expired deadline. All elements that expire at the same tick
+ * are handled in one go.
+ */
+class Net::Timeout_wheel
+{
+	public:
+
+		class Element;
+
+		template <typename> class Timeout;
+
+	private:
+
+		static constexpr unsigned         NR_OF_SLOTS = 64;
+		static constexpr Genode::uint64_t NO_TICK     = ~(Genode::uint64_t)0;
+
+		Cached_timer                           &_timer;
+		Genode::uint64_t                 const  _tick_us;
+		Element                                *_slots[NR_OF_SLOTS] { };
+		unsigned                                _nr_of_elements { 0 };
+		Genode::uint64_t                        _curr_tick;
+		Genode::uint64_t                        _timeout_tick { NO_TICK };
+		Timer::One_shot_timeout<Timeout_wheel>  _timeout;
+
+		/*
+		 * Noncopyable
+		 */
+		Timeout_wheel(Timeout_wheel const &);
+		Timeout_wheel &operator = (Timeout_wheel const &);
+
+		Genode::uint64_t _curr_us() const {
+			return _timer.cached_time().trunc_to_plain_us().value; }
+
+		Element *&_slot(Genode::uint64_t tick) { return _slots[tick % NR_OF_SLOTS]; }
+
+		void _insert(Element &elem);
+
+		void _remove(Element &elem);
+
+		void _expire_slot(Genode::uint64_t tick, Genode::uint64_t curr_tick,
+		                  Genode::Duration curr_time);
+
+		void _schedule_timeout(Genode::uint64_t tick);
+
+		void _schedule_next_timeout();
+
+		void _handle_timeout(Genode::Duration);
+
+	public:
+
+		Timeout_wheel(Cached_timer &timer, Genode::Microseconds tick);
+
+		~Timeout_wheel();
+
+		/**
+		 * Let 'elem' expire in 'duration' rounded up to the next tick
+		 */
+		void schedule(Element &elem, Genode::Microseconds duration);
+
+		void discard(Element &elem);
+};
+
+
+class Net::Timeout_wheel::Element
+{
+	friend class Timeout_wheel;
+
+	private:
+
+		using Handle_fn = void (*)(Element &, Genode::Duration);
+
+		Timeout_wheel    &_wheel;
+		Handle_fn  const  _handle_fn;
+		Timeout_wheel    *_wheel_ptr     { nullptr };
+		Element          *_prev          { nullptr };
+		Element          *_next          { nullptr };
+		Genode::uint64_t  _deadline_tick { 0 };
+
+		/*
+		 * Noncopyable
+		 */
+		Element(Element const &);
+		Element &operator = (Element const &);
+
+	protected:
+
+		Element(Timeout_wheel &wheel, Handle_fn handle_fn)
+		:
+			_wheel { wheel }, _handle_fn { handle_fn }
+		{ }
+
+		~Element() { discard(); }
+
+	public:
+
+		void schedule(Genode::Microseconds duration) { _wheel.schedule(*this, duration); }
+
+		void discard()
+		{
+			if (_wheel_ptr)
+				_wheel_ptr->discard(*this);
+		}
+
+		bool scheduled() const { return _wheel_ptr != nullptr; }
+};
+
+
+/**
+ * Timeout at a wheel that calls a method of 'HANDLER' when it expires
+ *
+ * The handler is called after the timeout was removed from the wheel and may
+ * thus reschedule or destruct the timeout.
+ */
+template <typename HANDLER>
+class Net::Timeout_wheel::Timeout : public Timeout_wheel::Element
+{
+	private:
+
+		using Handler_method = void (HANDLER::*)(Genode::Duration);
+
+		HANDLER              &_object;
+		Handler_method const  _method;
+
+		static void _handle(Element &elem, Genode::Duration curr_time)
+		{
+			Timeout &timeout = static_cast<Timeout &>(elem);
+			(timeout._object.*timeout._method)(curr_time);
+		}
+
+	public:
+
+		Timeout(Timeout_wheel &wheel, HANDLER &object, Handler_method method)
+		:
+			Element { wheel, &Timeout::_handle }, _object { object }, _method { method }
+		{ }
+};
+
+#endif /* _TIMEOUT_WHEEL_H_ */
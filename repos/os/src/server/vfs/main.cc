@@ -21,6 +21,8 @@
 #include <base/attached_rom_dataspace.h>
 #include <file_system_session/rpc_object.h>
 #include <root/component.h>
+#include <root/client.h>
+#include <util/dictionary.h>
 #include <os/session_policy.h>
 #include <vfs/simple_env.h>
 
@@ -36,9 +38,14 @@ namespace Vfs_server {
 	class Session_component;
 	class Vfs_env;
 	class Root;
+	class Worker_env;
+	class Worker;
+	class Main;
 
 	using Session_queue       = Genode::Fifo<Session_component>;
 	using Io_progress_handler = Genode::Entrypoint::Io_progress_handler;
+	using Worker_name         = Genode::String<32>;
+	using Workers             = Genode::Dictionary<Worker, Worker_name>;
 
 	/**
 	 * Convenience utities for parsing quotas
@@ -49,6 +56,60 @@ namespace Vfs_server {
 	Genode::Cap_quota parse_cap_quota(char const *args) {
 		return Genode::Cap_quota{
 			Genode::Arg_string::find_arg(args, "cap_quota").ulong_value(0)}; }
+
+	/**
+	 * Call 'fn' with the VFS configuration of a worker
+	 *
+	 * The VFS served by the initial entrypoint is configured by the
+	 * top-level '<vfs>' node. The VFS of a worker is configured by the
+	 * '<vfs>' node within the corresponding '<worker>' node.
+	 */
+	auto with_vfs_config(Genode::Node const &config, Worker_name const &worker,
+	                     auto const &fn, auto const &missing_fn)
+	-> decltype(missing_fn())
+	{
+		if (!worker.valid())
+			return config.with_sub_node("vfs", fn, missing_fn);
+
+		unsigned const NOT_FOUND = ~0U;
+		unsigned index = NOT_FOUND, i = 0;
+		config.for_each_sub_node([&] (Genode::Node const &node) {
+			if (index == NOT_FOUND && node.has_type("worker")
+			 && node.attribute_value("name", Worker_name()) == worker)
+				index = i;
+			i++;
+		});
+
+		return config.with_sub_node(index,
+			[&] (Genode::Node const &node) {
+				return node.with_sub_node("vfs", fn, missing_fn); },
+			missing_fn);
+	}
+
+	/**
+	 * Return true if a VFS configuration uses a plugin with global state
+	 *
+	 * The libraries behind these plugins, e.g., the Linux kernel emulation
+	 * of lxip or the rump kernel, keep their state in global variables and
+	 * must not be instantiated more than once per component. As each worker
+	 * has a VFS of its own, those plugins are reserved for the top-level
+	 * '<vfs>'.
+	 */
+	bool uses_singleton_plugin(Genode::Node const &vfs_config)
+	{
+		static char const * const types[] = {
+			"lxip", "lwip", "legacy_lwip", "rump", "fatfs", "libusb" };
+
+		bool result = false;
+		vfs_config.for_each_sub_node([&] (Genode::Node const &node) {
+			for (char const *type : types)
+				if (node.has_type(type))
+					result = true;
+
+			result = result || uses_singleton_plugin(node);
+		});
+		return result;
+	}
 };
 
 
@@ -762,6 +823,8 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>,
 
 		Genode::Env &_env;
 
+		Worker_name const _worker;
+
 		Genode::Attached_rom_dataspace _config_rom { _env, "config" };
 
 		Genode::Signal_handler<Root> _reactivate_handler {
@@ -773,9 +836,16 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>,
 		void _config_update()
 		{
 			_config_rom.update();
-			_config_rom.node().with_optional_sub_node("vfs",
+			with_vfs_config(_config_rom.node(), _worker,
 				[&] (Genode::Node const &config) {
-					_vfs_env.root_dir().apply_config(config); });
+					if (_worker.valid() && uses_singleton_plugin(config)) {
+						Genode::error("worker '", _worker, "': VFS configuration "
+						              "not applied, plugin is limited to the "
+						              "top-level <vfs>");
+						return;
+					}
+					_vfs_env.root_dir().apply_config(config); },
+				[&] { });
 
 			/*
 			 * The VFS configuration change may result in watch notifications
@@ -791,7 +861,7 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>,
 		 */
 		Genode::Heap _vfs_heap { &_env.ram(), &_env.rm() };
 
-		Vfs::Simple_env _vfs_env = _config_rom.node().with_sub_node("vfs",
+		Vfs::Simple_env _vfs_env = with_vfs_config(_config_rom.node(), _worker,
 			[&] (Genode::Node const &config) -> Vfs::Simple_env {
 				return { _env, _vfs_heap, config }; },
 			[&] () -> Vfs::Simple_env {
@@ -992,21 +1062,298 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>,
 
 	public:
 
-		Root(Genode::Env &env, Genode::Allocator &md_alloc)
+		/**
+		 * Constructor
+		 *
+		 * \param env     environment of the entrypoint that serves the
+		 *                sessions and the VFS of this root
+		 * \param worker  name of the worker, invalid for the initial
+		 *                entrypoint
+		 */
+		Root(Genode::Env &env, Genode::Allocator &md_alloc, Worker_name const &worker)
 		:
 			Root_component<Session_component>(&env.ep().rpc_ep(), &md_alloc),
-			_env(env)
+			_env(env), _worker(worker)
 		{
 			_env.ep().register_io_progress_handler(*this);
 			_config_rom.sigh(_config_handler);
-			env.parent().announce(env.ep().manage(*this));
 		}
 };
 
 
-void Component::construct(Genode::Env &env)
+/**
+ * Environment of a worker
+ *
+ * Signal handlers and RPC objects created with this environment are
+ * served by the entrypoint of the worker.
+ */
+class Vfs_server::Worker_env : public Genode::Env
 {
-	static Genode::Sliced_heap sliced_heap { env.ram(), env.rm() };
+	private:
+
+		Genode::Env        &_env;
+		Genode::Entrypoint &_ep;
+
+	public:
+
+		Worker_env(Genode::Env &env, Genode::Entrypoint &ep) : _env(env), _ep(ep) { }
+
+		Genode::Parent        &parent() override { return _env.parent(); }
+		Genode::Cpu_session   &cpu()    override { return _env.cpu(); }
+		Env::Local_rm         &rm()     override { return _env.rm(); }
+		Genode::Pd_session    &pd()     override { return _env.pd(); }
+		Genode::Ram_allocator &ram()    override { return _env.ram(); }
+		Genode::Entrypoint    &ep()     override { return _ep; }
+
+		Genode::Cpu_session_capability cpu_session_cap() override {
+			return _env.cpu_session_cap(); }
+
+		Genode::Pd_session_capability pd_session_cap() override {
+			return _env.pd_session_cap(); }
+
+		Genode::Id_space<Genode::Parent::Client> &id_space() override {
+			return _env.id_space(); }
+
+		Genode::Session_capability session(Genode::Parent::Service_name const &name,
+		                                   Genode::Parent::Client::Id id,
+		                                   Genode::Parent::Session_args const &args,
+		                                   Genode::Affinity const &affinity) override {
+			return _env.session(name, id, args, affinity); }
+
+		Session_result try_session(Genode::Parent::Service_name const &name,
+		                           Genode::Parent::Client::Id id,
+		                           Genode::Parent::Session_args const &args,
+		                           Genode::Affinity const &affinity) override {
+			return _env.try_session(name, id, args, affinity); }
+
+		void upgrade(Genode::Parent::Client::Id id,
+		             Genode::Parent::Upgrade_args const &args) override {
+			_env.upgrade(id, args); }
+
+		void close(Genode::Parent::Client::Id id) override { _env.close(id); }
+
+		/* already done at component startup */
+		void exec_static_constructors() override { }
+};
+
+
+/**
+ * Entrypoint that serves a group of sessions with a VFS of its own
+ *
+ * Sessions are assigned to a worker by the 'worker' attribute of their
+ * policy. The worker is created along with its first session. It serves
+ * the RPC functions, the packet streams, and the VFS plugins of its
+ * sessions on a dedicated thread. The VFS plugins are not shared with
+ * other workers. Hence, no locking is needed and a slow backend delays
+ * only the sessions of its worker.
+ *
+ * The VFS of a worker is a separate file system. Sessions of different
+ * workers do not observe each other's files, e.g., of a '<ram>' file
+ * system configured for both. Plugins with global state cannot be
+ * instantiated per worker and are refused for workers.
+ */
+class Vfs_server::Worker : public Workers::Element
+{
+	private:
+
+		enum { STACK_SIZE = 16*1024*sizeof(long) };
+
+		/*
+		 * The functions of the root interface are called via RPC and thereby
+		 * executed by the entrypoint of the worker. So the VFS of the worker
+		 * is created, configured, and used by the worker thread only.
+		 */
+		struct Root_object : Genode::Rpc_object<Genode::Typed_root<::File_system::Session>>
+		{
+			Genode::Env        &_env;
+			Genode::Allocator  &_md_alloc;
+			Worker_name  const  _name;
+
+			Genode::Constructible<Vfs_server::Root> _root { };
+
+			Root_object(Genode::Env &env, Genode::Allocator &md_alloc, Worker_name const &name)
+			: _env(env), _md_alloc(md_alloc), _name(name) { }
+
+			Result session(Session_args const &args, Genode::Affinity const &affinity) override
+			{
+				if (!_root.constructed())
+					_root.construct(_env, _md_alloc, _name);
+
+				return _root->session(args, affinity);
+			}
+
+			void upgrade(Genode::Session_capability session, Upgrade_args const &args) override
+			{
+				if (_root.constructed())
+					_root->upgrade(session, args);
+			}
+
+			void close(Genode::Session_capability session) override
+			{
+				if (_root.constructed())
+					_root->close(session);
+			}
+		};
+
+		Genode::Entrypoint _ep;
+
+		Worker_env _env;
+
+		Root_object _root_object;
+
+	public:
+
+		Genode::Root_capability const cap;
+
+		Worker(Genode::Env &env, Genode::Allocator &md_alloc, Workers &workers,
+		       Worker_name const &name, Genode::Affinity::Location location)
+		:
+			Workers::Element(workers, name),
+			_ep(env, STACK_SIZE, name.string(), location),
+			_env(env, _ep), _root_object(_env, md_alloc, name),
+			cap(_ep.manage(_root_object))
+		{ }
+};
 
-	static Vfs_server::Root root { env, sliced_heap };
+
+/**
+ * Root interface announced to the parent
+ *
+ * Session requests are forwarded to the root of the initial entrypoint or
+ * to the worker selected by the session policy.
+ */
+class Vfs_server::Main : public Genode::Rpc_object<Genode::Typed_root<::File_system::Session>>
+{
+	private:
+
+		Genode::Env &_env;
+
+		Genode::Sliced_heap _sliced_heap { _env.ram(), _env.rm() };
+
+		Genode::Attached_rom_dataspace _config_rom { _env, "config" };
+
+		Vfs_server::Root _root { _env, _sliced_heap, Worker_name() };
+
+		Workers _workers { };
+
+		unsigned _num_workers = 0;
+
+		/*
+		 * A session capability does not reveal the serving entrypoint.
+		 * Hence, the worker of each session is recorded at session creation
+		 * so that 'upgrade' and 'close' are forwarded to this worker only.
+		 */
+		struct Worker_session : Genode::List<Worker_session>::Element
+		{
+			Genode::Session_capability const cap;
+			Worker                     const &worker;
+
+			Worker_session(Genode::Session_capability cap, Worker const &worker)
+			: cap(cap), worker(worker) { }
+		};
+
+		Genode::Heap _heap { _env.ram(), _env.rm() };
+
+		Genode::List<Worker_session> _worker_sessions { };
+
+		void _with_worker_session(Genode::Session_capability cap,
+		                          auto const &fn, auto const &missing_fn)
+		{
+			for (Worker_session *s = _worker_sessions.first(); s; s = s->next())
+				if (s->cap == cap) {
+					fn(*s);
+					return;
+				}
+
+			missing_fn();
+		}
+
+		Worker_name _worker_name(Session_args const &args)
+		{
+			_config_rom.update();
+
+			return with_matching_policy(Genode::label_from_args(args.string()),
+			                            _config_rom.node(),
+				[&] (Genode::Node const &policy) {
+					return policy.attribute_value("worker", Worker_name()); },
+				[&] { return Worker_name(); });
+		}
+
+	public:
+
+		Main(Genode::Env &env) : _env(env)
+		{
+			_env.parent().announce(_env.ep().manage(*this));
+		}
+
+
+		/********************
+		 ** Root interface **
+		 ********************/
+
+		Result session(Session_args const &args, Genode::Affinity const &affinity) override
+		{
+			Worker_name const name = _worker_name(args);
+
+			if (!name.valid())
+				return _root.session(args, affinity);
+
+			bool const refused = with_vfs_config(_config_rom.node(), name,
+				[&] (Genode::Node const &vfs) { return uses_singleton_plugin(vfs); },
+				[&] { return false; });
+
+			if (refused) {
+				Genode::error("worker '", name, "' refused, its VFS uses a plugin "
+				              "that is limited to the top-level <vfs>");
+				return Genode::Session_error::DENIED;
+			}
+
+			auto session_at_worker = [&] (Worker const &worker) -> Result
+			{
+				Result const result = Genode::Root_client(worker.cap).session(args, affinity);
+
+				result.with_result(
+					[&] (Genode::Session_capability cap) {
+						_worker_sessions.insert(new (_heap) Worker_session(cap, worker)); },
+					[&] (Genode::Session_error) { });
+
+				return result;
+			};
+
+			return _workers.with_element(name, session_at_worker, [&] {
+
+				/* place workers on distinct CPUs, index 0 is the initial entrypoint */
+				Genode::Affinity::Location const location =
+					_env.cpu().affinity_space().location_of_index(++_num_workers);
+
+				Worker const &worker = *new (_sliced_heap)
+					Worker(_env, _sliced_heap, _workers, name, location);
+
+				return session_at_worker(worker);
+			});
+		}
+
+		void upgrade(Genode::Session_capability session, Upgrade_args const &args) override
+		{
+			_with_worker_session(session,
+				[&] (Worker_session &s) {
+					Genode::Root_client(s.worker.cap).upgrade(session, args); },
+				[&] { _root.upgrade(session, args); });
+		}
+
+		void close(Genode::Session_capability session) override
+		{
+			_with_worker_session(session,
+				[&] (Worker_session &s) {
+					Genode::Root_client(s.worker.cap).close(session);
+					_worker_sessions.remove(&s);
+					Genode::destroy(_heap, &s); },
+				[&] { _root.close(session); });
+		}
+};
+
+
+void Component::construct(Genode::Env &env)
+{
+	static Vfs_server::Main main { env };
 }
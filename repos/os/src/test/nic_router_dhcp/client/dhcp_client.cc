@@ -51,12 +51,16 @@ void append_param_req_list(Dhcp_options &dhcp_opts)
 Dhcp_client::Dhcp_client(Genode::Allocator   &alloc,
                          Timer::Connection   &timer,
                          Nic                 &nic,
+                         Mac_address   const &mac,
+                         bool                 log_events,
                          Dhcp_client_handler &handler)
 :
-	_alloc   (alloc),
-	_timeout (timer, *this, &Dhcp_client::_handle_timeout),
-	_nic     (nic),
-	_handler (handler)
+	_alloc      (alloc),
+	_timeout    (timer, *this, &Dhcp_client::_handle_timeout),
+	_nic        (nic),
+	_mac        (mac),
+	_log_events (log_events),
+	_handler    (handler)
 {
 	_discover();
 }
@@ -112,7 +116,7 @@ void Dhcp_client::_handle_timeout(Duration)
 
 void Dhcp_client::handle_eth(Ethernet_frame &eth, Size_guard &size_guard)
 {
-	if (eth.dst() != _nic.mac() &&
+	if (eth.dst() != _mac &&
 	    eth.dst() != Mac_address(0xff))
 	{
 		throw Drop_packet_inform("DHCP client expects Ethernet targeting the router");
@@ -129,7 +133,7 @@ void Dhcp_client::handle_eth(Ethernet_frame &eth, Size_guard &size_guard)
 	if (dhcp.op() != Dhcp_packet::REPLY) {
 		throw Drop_packet_inform("DHCP client expects DHCP reply"); }
 
-	if (dhcp.client_mac() != _nic.mac()) {
+	if (dhcp.client_mac() != _mac) {
 		throw Drop_packet_inform("DHCP client expects DHCP targeting the router"); }
 
 	try { _handle_dhcp_reply(dhcp); }
@@ -138,36 +142,21 @@ void Dhcp_client::handle_eth(Ethernet_frame &eth, Size_guard &size_guard)
 }
 
 
-void
-Dhcp_client::_handle_dhcp_reply_in_request_state(Message_type  msg_type,
-                                                 Dhcp_packet  &dhcp,
-                                                 char const   *request_state)
+void Dhcp_client::_log_event(Dhcp_packet &dhcp, char const *request_state)
 {
-	if (msg_type != Message_type::ACK) {
-		throw Drop_packet_inform("DHCP client expects an acknowledgement");
-	}
-	_lease_time_sec = dhcp.option<Dhcp_packet::Ip_lease_time>().value();
-	_set_state(State::BOUND, _rerequest_timeout(1));
-
 	static unsigned long event_idx { 0 };
 	log("Event ", ++event_idx, ", DHCP ", request_state, " completed:");
 	log("  IP lease time: ", _lease_time_sec, " seconds");
 	log("  Interface: ", Ipv4_address_prefix(dhcp.yiaddr(), dhcp.option<Dhcp_packet::Subnet_mask>().value()));
 	log("  Router: ", dhcp.option<Dhcp_packet::Router_ipv4>().value());
 
-	Ipv4_address dns_server_addr { };
 	unsigned idx { 1 };
 	try {
 		Dhcp_packet::Dns_server const &dns_server {
 			dhcp.option<Dhcp_packet::Dns_server>() };
 
 		dns_server.for_each_address([&] (Ipv4_address const &addr) {
-
-			if (!dns_server_addr.valid()) {
-				dns_server_addr = addr;
-			}
-			log("  DNS server #", idx++, ": ", addr);
-		});
+			log("  DNS server #", idx++, ": ", addr); });
 	}
 	catch (Dhcp_packet::Option_not_found) { }
 	try {
@@ -179,6 +168,32 @@ Dhcp_client::_handle_dhcp_reply_in_request_state(Message_type  msg_type,
 		});
 	}
 	catch (Dhcp_packet::Option_not_found) { }
+}
+
+
+void
+Dhcp_client::_handle_dhcp_reply_in_request_state(Message_type  msg_type,
+                                                 Dhcp_packet  &dhcp,
+                                                 char const   *request_state)
+{
+	if (msg_type != Message_type::ACK) {
+		throw Drop_packet_inform("DHCP client expects an acknowledgement");
+	}
+	_lease_time_sec = dhcp.option<Dhcp_packet::Ip_lease_time>().value();
+	_set_state(State::BOUND, _rerequest_timeout(1));
+
+	Ipv4_address dns_server_addr { };
+	try {
+		dhcp.option<Dhcp_packet::Dns_server>().for_each_address(
+			[&] (Ipv4_address const &addr) {
+				if (!dns_server_addr.valid()) {
+					dns_server_addr = addr; }
+			});
+	}
+	catch (Dhcp_packet::Option_not_found) { }
+
+	if (_log_events) {
+		_log_event(dhcp, request_state); }
 
 	Ipv4_config ip_config(
 		Ipv4_address_prefix(
@@ -226,7 +241,7 @@ void Dhcp_client::_send(Message_type msg_type,
 		/* create ETH header of the request */
 		Ethernet_frame &eth = Ethernet_frame::construct_at(pkt_base, size_guard);
 		eth.dst(Mac_address(0xff));
-		eth.src(_nic.mac());
+		eth.src(_mac);
 		eth.type(Ethernet_frame::Type::IPV4);
 
 		/* create IP header of the request */
@@ -253,7 +268,7 @@ void Dhcp_client::_send(Message_type msg_type,
 		dhcp.htype(Dhcp_packet::Htype::ETH);
 		dhcp.hlen(sizeof(Mac_address));
 		dhcp.ciaddr(client_ip);
-		dhcp.client_mac(_nic.mac());
+		dhcp.client_mac(_mac);
 		dhcp.default_magic_cookie();
 
 		/* append DHCP option fields to the request */
@@ -262,13 +277,13 @@ void Dhcp_client::_send(Message_type msg_type,
 		switch (msg_type) {
 		case Message_type::DISCOVER:
 			append_param_req_list(dhcp_opts);
-			dhcp_opts.append_option<Dhcp_packet::Client_id>(_nic.mac());
+			dhcp_opts.append_option<Dhcp_packet::Client_id>(_mac);
 			dhcp_opts.append_option<Dhcp_packet::Max_msg_size>(PKT_SIZE - dhcp_off);
 			break;
 
 		case Message_type::REQUEST:
 			append_param_req_list(dhcp_opts);
-			dhcp_opts.append_option<Dhcp_packet::Client_id>(_nic.mac());
+			dhcp_opts.append_option<Dhcp_packet::Client_id>(_mac);
 			dhcp_opts.append_option<Dhcp_packet::Max_msg_size>(PKT_SIZE - dhcp_off);
 			if (_state == State::REQUEST) {
 				dhcp_opts.append_option<Dhcp_packet::Requested_addr>(requested_ip);
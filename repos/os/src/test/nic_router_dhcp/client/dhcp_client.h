@@ -71,6 +71,8 @@ class Net::Dhcp_client
 		Genode::Microseconds const            _discover_timeout { (Genode::uint64_t)DISCOVER_TIMEOUT_SEC * 1000 * 1000 };
 		Genode::Microseconds const            _request_timeout  { (Genode::uint64_t)REQUEST_TIMEOUT_SEC * 1000 * 1000  };
 		Nic                                  &_nic;
+		Mac_address                    const  _mac;
+		bool                           const  _log_events;
 		Dhcp_client_handler                  &_handler;
 
 		void
@@ -80,6 +82,8 @@ class Net::Dhcp_client
 
 		void _handle_dhcp_reply(Dhcp_packet &dhcp);
 
+		void _log_event(Dhcp_packet &dhcp, char const *request_state);
+
 		void _handle_timeout(Genode::Duration);
 
 		void _rerequest(State next_state);
@@ -97,14 +101,24 @@ class Net::Dhcp_client
 
 	public:
 
+		/**
+		 * Constructor
+		 *
+		 * \param mac         client hardware address used in DHCP
+		 * \param log_events  whether to log each completed DHCP exchange
+		 */
 		Dhcp_client(Genode::Allocator   &alloc,
 		            Timer::Connection   &timer,
 		            Nic                 &nic,
+		            Mac_address   const &mac,
+		            bool                 log_events,
 		            Dhcp_client_handler &handler);
 
 		void handle_eth(Ethernet_frame &eth,
 		                Size_guard     &size_guard);
 
+		Mac_address const &mac() const { return _mac; }
+
 };
 
 #endif /* _DHCP_CLIENT_H_ */
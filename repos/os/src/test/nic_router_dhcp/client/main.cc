@@ -62,7 +62,7 @@ class Main : public Nic_handler,
 		void handle_link_state(bool link_state) override
 		{
 			if (!_link_state && link_state) {
-				_dhcp_client.construct(_heap, _timer, _nic, *this);
+				_dhcp_client.construct(_heap, _timer, _nic, _nic.mac(), true, *this);
 			}
 			if (_link_state && !link_state && ip_config().valid) {
 				ip_config(Ipv4_config { });
@@ -0,0 +1,191 @@
+/*
+ * \brief  Let many DHCP clients request an IP config from the NIC router at once
+ * \author Roland Baer
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include <nic.h>
+#include <ipv4_config.h>
+#include <dhcp_client.h>
+
+/* Genode includes */
+#include <net/ethernet.h>
+#include <net/ipv4.h>
+#include <net/udp.h>
+#include <base/component.h>
+#include <base/heap.h>
+#include <base/attached_rom_dataspace.h>
+#include <timer_session/connection.h>
+
+using namespace Net;
+using namespace Genode;
+
+
+class Main : public Nic_handler
+{
+	private:
+
+		enum { MAX_CLIENTS = 1024 };
+
+		/*
+		 * The clients use locally administered unicast MAC addresses that
+		 * encode the client index in the last two bytes.
+		 */
+		static Mac_address _client_mac(unsigned idx)
+		{
+			Mac_address mac { (uint8_t)0 };
+			mac.addr[0] = 0x12;
+			mac.addr[4] = (uint8_t)(idx >> 8);
+			mac.addr[5] = (uint8_t)idx;
+			return mac;
+		}
+
+		struct Client : Dhcp_client_handler
+		{
+			Main                         &main;
+			Mac_address            const  mac;
+			Reconstructible<Ipv4_config>  ip_cfg      { };
+			Constructible<Dhcp_client>    dhcp_client { };
+			bool                          bound       { false };
+
+			Client(Main &main, Mac_address const &mac) : main(main), mac(mac) { }
+
+			void ip_config(Ipv4_config const &ip_config) override
+			{
+				ip_cfg.construct(ip_config);
+				if (ip_config.valid && !bound) {
+					bound = true;
+					main._client_bound();
+				}
+			}
+
+			Ipv4_config const &ip_config() const override { return *ip_cfg; }
+		};
+
+		Env                          &_env;
+		Attached_rom_dataspace        _config      { _env, "config" };
+		Timer::Connection             _timer       { _env };
+		Heap                          _heap        { &_env.ram(), &_env.rm() };
+		bool                    const _verbose     { _config.node().attribute_value("verbose", false) };
+		unsigned                const _nr_of_clients;
+		Net::Nic                      _nic         { _env, _heap, *this, _verbose };
+		Constructible<Client>         _clients[MAX_CLIENTS];
+		unsigned                      _nr_of_bound { 0 };
+		bool                          _link_state  { false };
+		Timer::One_shot_timeout<Main> _initial_delay { _timer, *this, &Main::_handle_initial_delay };
+
+		void _handle_initial_delay(Duration);
+
+		void _client_bound();
+
+		void _with_client(Ethernet_frame &eth, Size_guard size_guard, auto const &fn);
+
+	public:
+
+		Main(Env &env);
+
+
+		/*****************
+		 ** Nic_handler **
+		 *****************/
+
+		void handle_eth(Ethernet_frame &eth,
+		                Size_guard     &size_guard) override;
+
+		void handle_link_state(bool link_state) override;
+};
+
+
+void Main::_client_bound()
+{
+	_nr_of_bound++;
+	if (_nr_of_bound % 100 == 0 || _nr_of_bound == _nr_of_clients) {
+		log(_nr_of_bound, " of ", _nr_of_clients, " DHCP clients bound"); }
+}
+
+
+void Main::_handle_initial_delay(Duration)
+{
+	log("Initialized");
+	_nic.handle_link_state();
+}
+
+
+void Main::handle_link_state(bool link_state)
+{
+	/* let all clients start DHCP at once */
+	if (!_link_state && link_state) {
+		for (unsigned idx = 0; idx < _nr_of_clients; idx++) {
+			_clients[idx]->dhcp_client.construct(
+				_heap, _timer, _nic, _clients[idx]->mac, false, *_clients[idx]); }
+	}
+	_link_state = link_state;
+}
+
+
+void Main::_with_client(Ethernet_frame &eth, Size_guard size_guard, auto const &fn)
+{
+	/* peek at the client MAC address without consuming the original guard */
+	Ipv4_packet &ip = eth.data<Ipv4_packet>(size_guard);
+	if (ip.protocol() != Ipv4_packet::Protocol::UDP) {
+		throw Drop_packet_inform("DHCP client expects UDP packet"); }
+
+	Udp_packet &udp = ip.data<Udp_packet>(size_guard);
+	if (!Dhcp_packet::is_dhcp(&udp)) {
+		throw Drop_packet_inform("DHCP client expects DHCP packet"); }
+
+	Mac_address const mac = udp.data<Dhcp_packet>(size_guard).client_mac();
+	unsigned const idx = ((unsigned)mac.addr[4] << 8) | mac.addr[5];
+	if (idx >= _nr_of_clients || mac != _client_mac(idx)) {
+		throw Drop_packet_inform("DHCP packet targets unknown client"); }
+
+	fn(*_clients[idx]);
+}
+
+
+void Main::handle_eth(Ethernet_frame &eth,
+                      Size_guard     &size_guard)
+{
+	try {
+		if (_verbose) {
+			log("rcv ", eth); }
+
+		_with_client(eth, size_guard, [&] (Client &client) {
+			if (!client.dhcp_client.constructed()) {
+				throw Drop_packet_inform("DHCP client not started yet"); }
+
+			if (client.ip_config().valid) {
+				throw Drop_packet_inform("IP config still valid"); }
+
+			client.dhcp_client->handle_eth(eth, size_guard);
+		});
+	}
+	catch (Drop_packet_inform exception) {
+		if (_verbose) {
+			log("drop packet: ", exception.msg); }
+	}
+}
+
+
+Main::Main(Env &env)
+:
+	_env(env),
+	_nr_of_clients(min(_config.node().attribute_value("clients", 500U),
+	                   (unsigned)MAX_CLIENTS))
+{
+	for (unsigned idx = 0; idx < _nr_of_clients; idx++) {
+		_clients[idx].construct(*this, _client_mac(idx)); }
+
+	_initial_delay.schedule(Microseconds { 1000000 });
+}
+
+
+void Component::construct(Env &env) { static Main main(env); }
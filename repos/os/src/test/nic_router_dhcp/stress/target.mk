@@ -0,0 +1,15 @@
+TARGET = test-nic_router_dhcp-stress
+
+LIBS += base net
+
+SRC_CC += main.cc dhcp_client.cc ipv4_address_prefix.cc
+SRC_CC += nic.cc ipv4_config.cc
+
+INC_DIR += $(PRG_DIR) $(PRG_DIR)/../client $(REP_DIR)/src/server/nic_router
+
+vpath dhcp_client.cc         $(PRG_DIR)/../client
+vpath nic.cc                 $(PRG_DIR)/../client
+vpath ipv4_config.cc         $(PRG_DIR)/../client
+vpath ipv4_address_prefix.cc $(REP_DIR)/src/server/nic_router
+
+CC_CXX_WARN_STRICT_CONVERSION =
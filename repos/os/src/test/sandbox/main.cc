@@ -12,6 +12,7 @@
  */
 
 #include <base/component.h>
+#include <base/attached_rom_dataspace.h>
 #include <log_session/log_session.h>
 #include <base/session_object.h>
 #include <os/buffered_xml.h>
@@ -47,6 +48,18 @@ struct Test::Main : Sandbox::Local_service_base::Wakeup
 
 	Heap _heap { _env.ram(), _env.rm() };
 
+	Attached_rom_dataspace _config { _env, "config" };
+
+	/*
+	 * Number of additional children hosted in the sandbox, which allows for
+	 * measuring the cost of config updates for large configurations
+	 *
+	 * Each of those children opens a session to the local LOG service. With
+	 * each config update, a server appears or disappears, which prompts the
+	 * sandbox to re-evaluate the routes of the children that are affected.
+	 */
+	unsigned const _num_children = _config.node().attribute_value("children", 0u);
+
 	struct State_handler : Sandbox::State_handler
 	{
 		void handle_sandbox_state() override { }
@@ -121,6 +134,59 @@ struct Test::Main : Sandbox::Local_service_base::Wakeup
 					xml.node("parent", [&] () { }); });
 			});
 		});
+
+		if (_num_children == 0)
+			return;
+
+		for (unsigned i = 0; i < _num_children; i++)
+			xml.node("start", [&] () {
+				xml.attribute("name", String<32>("child-", i));
+				xml.attribute("caps", 100);
+				xml.node("resource", [&] () {
+					xml.attribute("name", "RAM");
+					xml.attribute("quantum", "1M");
+				});
+				xml.node("binary", [&] () {
+					xml.attribute("name", "dummy"); });
+
+				xml.node("config", [&] () {
+					xml.node("create_log_connections", [&] () {
+						xml.attribute("count", "1"); }); });
+
+				xml.node("route", [&] () {
+
+					xml.node("service", [&] () {
+						xml.attribute("name", "LOG");
+						xml.node("local", [&] () { }); });
+
+					xml.node("any-service", [&] () {
+						xml.node("parent", [&] () { }); });
+				});
+			});
+
+		/*
+		 * The declared service is never announced by the dummy server, which
+		 * is fine as none of the children requests it.
+		 */
+		if (_dummy_version % 2)
+			xml.node("start", [&] () {
+				xml.attribute("name", "server");
+				xml.attribute("caps", 100);
+				xml.node("resource", [&] () {
+					xml.attribute("name", "RAM");
+					xml.attribute("quantum", "1M");
+				});
+				xml.node("binary", [&] () {
+					xml.attribute("name", "dummy"); });
+
+				xml.node("provides", [&] () {
+					xml.node("service", [&] () {
+						xml.attribute("name", "Report"); }); });
+
+				xml.node("route", [&] () {
+					xml.node("any-service", [&] () {
+						xml.node("parent", [&] () { }); }); });
+			});
 	}
 
 	void _update_sandbox_config()
@@ -128,10 +194,16 @@ struct Test::Main : Sandbox::Local_service_base::Wakeup
 		Buffered_xml const config { _heap, "config", [&] (Xml_generator &xml) {
 			_generate_sandbox_config(xml); } };
 
-		log("generated config: ", config.xml);
+		if (_num_children == 0)
+			log("generated config: ", config.xml);
+
+		uint64_t const start_us = _timer.elapsed_us();
 
 		config.xml.with_raw_node([&] (char const *start, size_t num_bytes) {
 			_sandbox.apply_config(Node(Const_byte_range_ptr(start, num_bytes))); });
+
+		log("applied config version ", _dummy_version, " with ",
+		    _num_children, " children in ", _timer.elapsed_us() - start_us, " us");
 	}
 
 	/**
@@ -0,0 +1,106 @@
+/*
+ * \brief  Test for the throughput of a terminal session
+ * \author Roland Baer
+ * \date   2026-10-19
+ *
+ * The test writes lines of text to a terminal, similar to the output of
+ * 'cat' for a large log file, and reports the achieved throughput. With a
+ * graphical terminal, the throughput is dominated by the rendering of
+ * scrolled text.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <terminal_session/connection.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Main;
+}
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Terminal::Connection _terminal { _env };
+	Timer::Connection    _timer    { _env };
+
+	size_t const _total_bytes =
+		_config.node().attribute_value("size", Number_of_bytes(4*1024*1024));
+
+	enum { MAX_LINE_LEN = 160 };
+
+	char _line[MAX_LINE_LEN + 2] { };
+
+	/**
+	 * Fill line buffer, the line length varies with the line number
+	 */
+	size_t _generate_line(unsigned long n)
+	{
+		String<32> const prefix("line ", n, ": ");
+
+		size_t const len = min((size_t)MAX_LINE_LEN,
+		                       prefix.length() - 1 + (n*37) % 120);
+
+		memcpy(_line, prefix.string(), prefix.length() - 1);
+
+		for (size_t i = prefix.length() - 1; i < len; i++)
+			_line[i] = (char)('a' + (n + i) % 26);
+
+		_line[len]     = '\r';
+		_line[len + 1] = '\n';
+
+		return len + 2;
+	}
+
+	void _write_all(char const *src, size_t num_bytes)
+	{
+		while (num_bytes) {
+			size_t const n = _terminal.write(src, num_bytes);
+			src       += n;
+			num_bytes -= n;
+		}
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- terminal throughput test started ---");
+
+		uint64_t const start_ms = _timer.elapsed_ms();
+
+		size_t        written = 0;
+		unsigned long lines   = 0;
+
+		while (written < _total_bytes) {
+			size_t const n = _generate_line(lines++);
+			_write_all(_line, n);
+			written += n;
+		}
+
+		uint64_t const duration_ms = max(_timer.elapsed_ms() - start_ms, (uint64_t)1);
+
+		log("wrote ", written, " bytes (", lines, " lines) in ", duration_ms, " ms, ",
+		    (written*1000/duration_ms)/1024, " KiB/s");
+
+		log("--- terminal throughput test finished ---");
+
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }